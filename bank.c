@@ -0,0 +1,196 @@
+/*
+  Sudoku precomputed game bank
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+
+#include "bank.h"
+#include "solve.h"
+
+/*
+    The bank file starts with a 16-byte header:
+    - the magic string "SUDOKU",
+    - the format version as a 16-bit little endian number,
+    - the first game number and the number of games, as 32-bit little endian numbers.
+
+    It is followed by one record per game, in game number order. A record stores
+    the solution, 2 cells per byte, a bitmap of the cells that are given in the
+    puzzle, the level and the score. A record takes 55 bytes, and a bank of
+    10000 games about 540 KB.
+
+    Once mapped, the games are also indexed by increasing score, in order to
+    find quickly a game harder than a given score.
+*/
+
+#define BANK_MAGIC          "SUDOKU"
+#define BANK_VERSION        3      // with scores
+#define BANK_HEADER_SIZE    16
+
+typedef struct {
+    uint8_t solution[(SUDOKU_N_CELLS + 1) / 2];     // low nibble first
+    uint8_t givens[(SUDOKU_N_CELLS + 7) / 8];       // bit set if the cell is given
+    uint8_t level;
+    uint8_t score[2];                               // little endian
+} bank_record_t;
+
+static const uint8_t *bank;         // mapped file, NULL if not available
+static uint32_t bank_first, bank_n_games;
+static pthread_once_t bank_once = PTHREAD_ONCE_INIT;    // mapped once, shared by all sessions
+static uint32_t *score_index;       // game indexes by increasing score
+
+static uint32_t get_le( const uint8_t *bytes, int n_bytes )
+{
+    uint32_t value = 0;
+    while ( n_bytes-- ) {
+        value = (value << 8) | bytes[n_bytes];
+    }
+    return value;
+}
+
+static void set_le( uint8_t *bytes, int n_bytes, uint32_t value )
+{
+    for ( int i = 0; i < n_bytes; ++i ) {
+        bytes[i] = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+static const bank_record_t *get_record( uint32_t index )
+{
+    return (const bank_record_t *)( bank + BANK_HEADER_SIZE ) + index;
+}
+
+static int get_record_score( uint32_t index )
+{
+    return (int)get_le( get_record( index )->score, 2 );
+}
+
+static int compare_scores( const void *a, const void *b )
+{
+    uint32_t index_a = *(const uint32_t *)a, index_b = *(const uint32_t *)b;
+    int diff = get_record_score( index_a ) - get_record_score( index_b );
+    if ( diff ) return diff;
+    return ( index_a > index_b ) - ( index_a < index_b );
+}
+
+static void index_bank( void )
+{
+    score_index = malloc( bank_n_games * sizeof(uint32_t) );
+    if ( NULL == score_index ) return;
+
+    for ( uint32_t i = 0; i < bank_n_games; ++i ) {
+        score_index[i] = i;
+    }
+    qsort( score_index, bank_n_games, sizeof(uint32_t), compare_scores );
+}
+
+static void map_bank( void )
+{
+    const char *path = getenv( "SUDOKU_BANK" );
+    if ( NULL == path ) path = SUDOKU_BANK_PATH;
+
+    int fd = open( path, O_RDONLY );
+    if ( -1 == fd ) return;
+
+    struct stat st;
+    if ( 0 == fstat( fd, &st ) && st.st_size >= BANK_HEADER_SIZE ) {
+        void *map = mmap( NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+        if ( MAP_FAILED != map ) {
+            const uint8_t *header = map;
+            uint32_t n_games = get_le( &header[12], 4 );
+
+            if ( 0 == memcmp( header, BANK_MAGIC, 6 ) &&
+                 BANK_VERSION == get_le( &header[6], 2 ) &&
+                 (size_t)st.st_size == BANK_HEADER_SIZE + n_games * sizeof(bank_record_t) ) {
+                bank = map;
+                bank_first = get_le( &header[8], 4 );
+                bank_n_games = n_games;
+                index_bank( );
+            } else {
+                fprintf( stderr, "Ignoring invalid game bank %s\n", path );
+                munmap( map, (size_t)st.st_size );
+            }
+        }
+    }
+    close( fd );
+}
+
+extern bool get_bank_game( int game_nb, sudoku_grid_t *puzzle, sudoku_grid_t *solution,
+                           sudoku_level_t *level, int *score )
+{
+    pthread_once( &bank_once, map_bank );
+    if ( NULL == bank || game_nb < 0 ) return false;
+
+    uint32_t index = (uint32_t)game_nb - bank_first;
+    if ( (uint32_t)game_nb < bank_first || index >= bank_n_games ) return false;
+
+    const bank_record_t *record = get_record( index );
+    if ( record->level < EASY || record->level > DIFFICULT ) return false;   // corrupted bank
+
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; ++cell ) {
+        int8_t symbol = (int8_t)( ( record->solution[cell / 2] >> ( 4 * (cell & 1) ) ) & 0x0f );
+        if ( symbol < 1 || symbol > SUDOKU_N_SYMBOLS ) return false;
+        solution->cells[cell] = symbol;
+        puzzle->cells[cell] = ( record->givens[cell / 8] & ( 1 << (cell & 7) ) ) ?
+                                symbol : SUDOKU_EMPTY_CELL;
+    }
+    *level = (sudoku_level_t)record->level;
+    *score = (int)get_le( record->score, 2 );
+    return true;
+}
+
+extern int get_bank_game_by_score( int min_score )
+{
+    pthread_once( &bank_once, map_bank );
+    if ( NULL == score_index ) return -1;
+
+    uint32_t low = 0, high = bank_n_games;      // binary search in [low, high)
+    while ( low < high ) {
+        uint32_t mid = low + (high - low) / 2;
+        if ( get_record_score( score_index[mid] ) < min_score ) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if ( low == bank_n_games ) return -1;
+    return (int)( bank_first + score_index[low] );
+}
+
+extern bool write_bank( const char *path, int first_nb, int last_nb )
+{
+    FILE *fp = fopen( path, "wb" );
+    if ( NULL == fp ) return false;
+
+    uint8_t header[BANK_HEADER_SIZE] = { 0 };
+    memcpy( header, BANK_MAGIC, 6 );
+    set_le( &header[6], 2, BANK_VERSION );
+    set_le( &header[8], 4, (uint32_t)first_nb );
+    set_le( &header[12], 4, (uint32_t)(1 + last_nb - first_nb) );
+    bool done = ( 1 == fwrite( header, sizeof(header), 1, fp ) );
+
+    for ( int game_nb = first_nb; done && game_nb <= last_nb; ++game_nb ) {
+        sudoku_grid_t puzzle, solution;
+        make_numbered_puzzle( game_nb, &puzzle, &solution );
+
+        bank_record_t record;
+        memset( &record, 0, sizeof(record) );
+        for ( int cell = 0; cell < SUDOKU_N_CELLS; ++cell ) {
+            record.solution[cell / 2] |= (uint8_t)( solution.cells[cell] << ( 4 * (cell & 1) ) );
+            if ( SUDOKU_EMPTY_CELL != puzzle.cells[cell] ) {
+                record.givens[cell / 8] |= (uint8_t)( 1 << (cell & 7) );
+            }
+        }
+        sudoku_hint_stats_t hstats;
+        record.level = (uint8_t)sudoku_rate_puzzle( &puzzle, &hstats );
+        set_le( record.score, 2, (uint32_t)hstats.score );
+        done = ( 1 == fwrite( &record, sizeof(record), 1, fp ) );
+    }
+    return ( 0 == fclose( fp ) ) && done;
+}
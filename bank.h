@@ -0,0 +1,33 @@
+/*
+  sudoku bank.h
+
+  Suduku game: precomputed game bank declarations
+*/
+
+#ifndef __BANK_H__
+#define __BANK_H__
+
+#include "sudoku.h"
+
+/* The bank is a binary file with the puzzle, the solution and the level of
+   each game number, made once with write_bank (make bank). At the first
+   request, the file is mapped in memory from the path given by the environment
+   variable SUDOKU_BANK, or by default from SUDOKU_BANK_PATH. */
+#ifndef SUDOKU_BANK_PATH
+#define SUDOKU_BANK_PATH    "sudoku.bank"
+#endif
+
+/* return false if there is no bank, if game_nb is not in the bank or if its record
+   is invalid, true otherwise with the puzzle, its solution, its level and its score. */
+extern bool get_bank_game( int game_nb, sudoku_grid_t *puzzle, sudoku_grid_t *solution,
+                           sudoku_level_t *level, int *score );
+
+/* return the number of the game with the lowest score at least equal to
+   min_score, or -1 if there is no bank or no such game. */
+extern int get_bank_game_by_score( int min_score );
+
+/* generate and rate all games from first_nb to last_nb included, and write them
+   in a new bank file. It returns false if the file cannot be written. */
+extern bool write_bank( const char *path, int first_nb, int last_nb );
+
+#endif /* __BANK_H__ */
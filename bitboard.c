@@ -0,0 +1,277 @@
+/*
+  Sudoku bitboard solver engine
+*/
+#include <string.h>
+
+#include "bitboard.h"
+
+/*
+    This engine is an alternative to DLX. The state of a grid is given by:
+    - the candidate map of each cell (a single bit once the cell is solved),
+    - the map of symbols already placed in each row, column and box,
+    - the set of cells still to solve, as a 81-bit set (2 64-bit words).
+
+    After each placement, the state is propagated to a fixpoint:
+    - a cell whose candidates are all placed in its row, column or box is a
+      contradiction, a cell with only one candidate left is a naked single,
+    - a symbol that cannot go anywhere in a unit is a contradiction, a symbol
+      that can go in only one cell of a unit is a hidden single.
+
+    When nothing more can be deduced, the search branches on the unsolved cell
+    with the fewest candidates (minimum remaining values), trying each candidate
+    on a copy of the state, so that backtracking is simply dropping the copy.
+*/
+
+typedef struct {
+    uint16_t    cells[SUDOKU_N_CELLS];  // candidate map of each cell
+    uint16_t    rows[SUDOKU_N_ROWS],    // symbols placed in each row,
+                cols[SUDOKU_N_COLS],    // in each column
+                boxes[SUDOKU_N_BOXES];  // and in each box
+    uint64_t    unsolved[2];            // cells 0-63 and 64-80 still to solve
+} bb_state_t;
+
+#define ROW_OF(_cell)   ((_cell) / SUDOKU_N_COLS)
+#define COL_OF(_cell)   ((_cell) % SUDOKU_N_COLS)
+#define BOX_OF(_cell)   ((ROW_OF(_cell) / 3) * 3 + COL_OF(_cell) / 3)
+
+// cell index of the i-th cell in each unit
+#define ROW_CELL(_row,_i)   ((_row) * SUDOKU_N_COLS + (_i))
+#define COL_CELL(_col,_i)   ((_i) * SUDOKU_N_COLS + (_col))
+#define BOX_CELL(_box,_i)   ((((_box) / 3) * 3 + (_i) / 3) * SUDOKU_N_COLS + ((_box) % 3) * 3 + (_i) % 3)
+
+static inline bool is_unsolved( const bb_state_t *state, int cell )
+{
+    return state->unsolved[cell >> 6] & ((uint64_t)1 << (cell & 63));
+}
+
+static inline uint16_t get_placed( const bb_state_t *state, int cell )
+{
+    return state->rows[ROW_OF(cell)] | state->cols[COL_OF(cell)] | state->boxes[BOX_OF(cell)];
+}
+
+static bool place( bb_state_t *state, int cell, uint16_t symbol_bit )
+// return false if the symbol is already placed in the same row, column or box
+{
+    if ( get_placed( state, cell ) & symbol_bit ) return false;
+
+    state->cells[cell] = symbol_bit;
+    state->rows[ROW_OF(cell)] |= symbol_bit;
+    state->cols[COL_OF(cell)] |= symbol_bit;
+    state->boxes[BOX_OF(cell)] |= symbol_bit;
+    state->unsolved[cell >> 6] &= ~((uint64_t)1 << (cell & 63));
+    return true;
+}
+
+typedef enum {
+    PROPAGATION_CONTRADICTION, PROPAGATION_PROGRESS, PROPAGATION_STABLE
+} propagation_t;
+
+static propagation_t update_naked_singles( bb_state_t *state )
+{
+    propagation_t result = PROPAGATION_STABLE;
+    for ( int w = 0; w < 2; ++w ) {
+        uint64_t todo = state->unsolved[w];
+        while ( todo ) {
+            int cell = (w << 6) + __builtin_ctzll( todo );
+            todo &= todo - 1;
+
+            uint16_t map = state->cells[cell] & ~get_placed( state, cell );
+            if ( 0 == map ) return PROPAGATION_CONTRADICTION;
+
+            state->cells[cell] = map;
+            if ( 0 == ( map & (map - 1) ) ) {           // single candidate left
+                if ( ! place( state, cell, map ) ) return PROPAGATION_CONTRADICTION;
+                result = PROPAGATION_PROGRESS;
+            }
+        }
+    }
+    return result;
+}
+
+static propagation_t update_hidden_singles_in_unit( bb_state_t *state, const int *unit_cells,
+                                                    uint16_t placed )
+{
+    uint16_t once = 0, twice = 0;
+    for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+        int cell = unit_cells[i];
+        if ( ! is_unsolved( state, cell ) ) continue;
+        uint16_t map = state->cells[cell];
+        twice |= once & map;
+        once |= map;
+    }
+    if ( ( once | placed ) != SUDOKU_SYMBOL_MASK ) return PROPAGATION_CONTRADICTION;
+
+    uint16_t hidden = once & ~twice & ~placed;
+    if ( 0 == hidden ) return PROPAGATION_STABLE;
+
+    for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+        int cell = unit_cells[i];
+        if ( ! is_unsolved( state, cell ) ) continue;
+        uint16_t map = state->cells[cell] & hidden;
+        if ( 0 == map ) continue;
+        if ( map & (map - 1) ) return PROPAGATION_CONTRADICTION; // 2 symbols for 1 cell
+        if ( ! place( state, cell, map ) ) return PROPAGATION_CONTRADICTION;
+    }
+    return PROPAGATION_PROGRESS;
+}
+
+static propagation_t update_hidden_singles( bb_state_t *state )
+{
+    propagation_t result = PROPAGATION_STABLE;
+    int unit_cells[SUDOKU_N_SYMBOLS];
+
+    for ( int u = 0; u < SUDOKU_N_ROWS; ++u ) {
+        for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) unit_cells[i] = ROW_CELL( u, i );
+        propagation_t res = update_hidden_singles_in_unit( state, unit_cells, state->rows[u] );
+        if ( PROPAGATION_CONTRADICTION == res ) return res;
+        if ( PROPAGATION_PROGRESS == res ) result = res;
+
+        for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) unit_cells[i] = COL_CELL( u, i );
+        res = update_hidden_singles_in_unit( state, unit_cells, state->cols[u] );
+        if ( PROPAGATION_CONTRADICTION == res ) return res;
+        if ( PROPAGATION_PROGRESS == res ) result = res;
+
+        for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) unit_cells[i] = BOX_CELL( u, i );
+        res = update_hidden_singles_in_unit( state, unit_cells, state->boxes[u] );
+        if ( PROPAGATION_CONTRADICTION == res ) return res;
+        if ( PROPAGATION_PROGRESS == res ) result = res;
+    }
+    return result;
+}
+
+static bool propagate( bb_state_t *state )
+// return false in case of contradiction
+{
+    while ( true ) {
+        propagation_t res = update_naked_singles( state );
+        if ( PROPAGATION_CONTRADICTION == res ) return false;
+        if ( PROPAGATION_PROGRESS == res ) continue;    // naked singles first, they are cheaper
+
+        res = update_hidden_singles( state );
+        if ( PROPAGATION_CONTRADICTION == res ) return false;
+        if ( PROPAGATION_STABLE == res ) return true;
+    }
+}
+
+static int get_mrv_cell( const bb_state_t *state )
+{
+    int best_cell = -1, min_candidates = SUDOKU_N_SYMBOLS + 1;
+    for ( int w = 0; w < 2; ++w ) {
+        uint64_t todo = state->unsolved[w];
+        while ( todo ) {
+            int cell = (w << 6) + __builtin_ctzll( todo );
+            todo &= todo - 1;
+
+            int n_candidates = __builtin_popcount( state->cells[cell] );
+            if ( n_candidates < min_candidates ) {
+                best_cell = cell;
+                min_candidates = n_candidates;
+                if ( 2 == n_candidates ) return best_cell;  // cannot do better
+            }
+        }
+    }
+    return best_cell;
+}
+
+static void store_solution( const bb_state_t *state, sudoku_grid_t *solution )
+{
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; ++cell ) {
+        solution->cells[cell] = (int8_t)(1 + __builtin_ctz( state->cells[cell] ));
+    }
+}
+
+static int search( bb_state_t *state, int n_solutions, int count, sudoku_grid_t *solution )
+// return the updated count of solutions
+{
+    if ( ! propagate( state ) ) return count;
+
+    int cell = get_mrv_cell( state );
+    if ( -1 == cell ) {                                 // all cells solved
+        if ( 0 == count && solution ) store_solution( state, solution );
+        return count + 1;
+    }
+
+    uint16_t map = state->cells[cell];
+    while ( map ) {                                     // try each candidate on a copy
+        uint16_t symbol_bit = map & -map;
+        map &= map - 1;
+
+        bb_state_t branch = *state;
+        if ( place( &branch, cell, symbol_bit ) ) {
+            count = search( &branch, n_solutions, count, solution );
+            if ( count >= n_solutions ) break;
+        }
+    }
+    return count;
+}
+
+static bool fill( bb_state_t *state, random_state_t *random, sudoku_grid_t *grid )
+// same as search, but trying candidates in random order and stopping at the first solution
+{
+    if ( ! propagate( state ) ) return false;
+
+    int cell = get_mrv_cell( state );
+    if ( -1 == cell ) {
+        store_solution( state, grid );
+        return true;
+    }
+
+    uint16_t map = state->cells[cell];
+    while ( map ) {
+        uint16_t symbol_bit = map;
+        for ( int k = random_state_value( random, 0, __builtin_popcount( map ) - 1 ); k > 0; --k ) {
+            symbol_bit &= symbol_bit - 1;
+        }
+        symbol_bit &= -symbol_bit;
+        map &= ~symbol_bit;
+
+        bb_state_t branch = *state;
+        if ( place( &branch, cell, symbol_bit ) && fill( &branch, random, grid ) ) return true;
+    }
+    return false;
+}
+
+static bool init_state( bb_state_t *state, const sudoku_grid_t *puzzle )
+// return false if the puzzle is invalid
+{
+    memset( state, 0, sizeof(*state) );
+    state->unsolved[0] = ~(uint64_t)0;
+    state->unsolved[1] = ((uint64_t)1 << (SUDOKU_N_CELLS - 64)) - 1;
+
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; ++cell ) {
+        state->cells[cell] = SUDOKU_SYMBOL_MASK;
+    }
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; ++cell ) {
+        int symbol = puzzle->cells[cell];
+        if ( SUDOKU_EMPTY_CELL == symbol ) continue;
+        if ( symbol < 1 || symbol > SUDOKU_N_SYMBOLS ) return false;
+        if ( ! place( state, cell, (uint16_t)(1 << (symbol - 1)) ) ) return false;
+    }
+    return true;
+}
+
+extern int bitboard_solve( const sudoku_grid_t *puzzle, int n_solutions,
+                           sudoku_grid_t *solution )
+{
+    bb_state_t state;
+    if ( ! init_state( &state, puzzle ) ) return 0;
+    return search( &state, n_solutions, 0, solution );
+}
+
+extern void bitboard_fill_random( random_state_t *random, sudoku_grid_t *grid )
+{
+    bb_state_t state;
+    memset( grid, SUDOKU_EMPTY_CELL, sizeof(*grid) );
+    init_state( &state, grid );
+    fill( &state, random, grid );                           // an empty grid always has a solution
+}
+
+extern bool bitboard_has_other_solution( const sudoku_grid_t *puzzle, int cell, int symbol )
+{
+    bb_state_t state;
+    if ( ! init_state( &state, puzzle ) ) return false;
+
+    state.cells[cell] &= (uint16_t)~(1 << (symbol - 1));
+    if ( 0 == state.cells[cell] ) return false;
+    return 0 != search( &state, 1, 0, NULL );
+}
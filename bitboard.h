@@ -0,0 +1,32 @@
+/*
+  sudoku bitboard.h
+
+  Suduku game: bitboard solver engine declarations
+*/
+
+#ifndef __BITBOARD_H__
+#define __BITBOARD_H__
+
+#include "sudoku.h"
+#include "rand.h"
+
+/* Solve puzzle with candidate bitmasks and constraint propagation. It returns
+   the number of solutions found, up to n_solutions, and stores the first one
+   in solution if it is not NULL (solution may be the puzzle itself). The solver
+   state is entirely on the caller's stack, so that it can be called from any
+   number of threads at the same time. */
+extern int bitboard_solve( const sudoku_grid_t *puzzle, int n_solutions,
+                           sudoku_grid_t *solution );
+
+/* Fill grid with a random complete solution, in a single randomized search
+   drawing from the random state. */
+extern void bitboard_fill_random( random_state_t *random, sudoku_grid_t *grid );
+
+/* Return true if puzzle has a solution with a symbol different from symbol
+   (1 to 9) in cell, which must be empty in puzzle. This is how a puzzle known
+   to have a single solution with symbol in cell is checked for uniqueness
+   after removing that given: a single solution must be found or ruled out,
+   instead of counting up to 2 solutions. */
+extern bool bitboard_has_other_solution( const sudoku_grid_t *puzzle, int cell, int symbol );
+
+#endif /* __BITBOARD_H__ */
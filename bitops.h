@@ -0,0 +1,64 @@
+/*
+  sudoku bitops.h
+
+  Suduku game: bit operations on candidate and location maps
+*/
+
+#ifndef __BITOPS_H__
+#define __BITOPS_H__
+
+/* Candidate maps (1 bit per symbol) and location maps (1 bit per cell in a row,
+   column or box) are small bit maps. Counting and extracting their bits is done
+   with the processor instructions when the compiler is allowed to use them (popcnt
+   with -mpopcnt, tzcnt with -mbmi, or both with -march=native), and otherwise
+   with branch free portable code. Those functions are inline, so that there is no
+   call in the hint inner loops. */
+
+// return the number of bits (candidates or locations) in a map.
+static inline int get_n_bits_from_map( int map )
+{
+#if defined(__GNUC__) && defined(__POPCNT__)
+    return __builtin_popcount( (unsigned int)map );
+#else
+    unsigned int m = (unsigned int)map;         // SWAR count, 2, 4, 8 then 32 bits at once
+    m = m - ( ( m >> 1 ) & 0x55555555u );
+    m = ( m & 0x33333333u ) + ( ( m >> 2 ) & 0x33333333u );
+    m = ( m + ( m >> 4 ) ) & 0x0f0f0f0fu;
+    return (int)( ( m * 0x01010101u ) >> 24 );
+#endif
+}
+
+// return the index of the lowest bit set in a non-zero map.
+static inline int get_lowest_bit_from_map( int map )
+{
+#if defined(__GNUC__)
+    return __builtin_ctz( (unsigned int)map ); // tzcnt with -mbmi, bsf otherwise
+#else
+    static const int debruijn_bits[32] = {
+         0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+        31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+    unsigned int lowest = (unsigned int)map & ( 0u - (unsigned int)map );
+    return debruijn_bits[ ( lowest * 0x077cb531u ) >> 27 ];
+#endif
+}
+
+// remove the lowest bit from map and return its index, or -1 if map is empty.
+static inline int extract_bit_from_map( int *map )
+{
+    if ( 0 == *map ) return -1;
+
+    int bit = get_lowest_bit_from_map( *map );
+    *map &= *map - 1;
+    return bit;
+}
+
+// return the symbol number [0..8] in a single symbol map, or -1 if the map does
+// not contain exactly 1 symbol.
+static inline int get_number_from_map( unsigned short map )
+{
+    if ( (unsigned int)map - 1 > 255 || ( map & ( map - 1 ) ) ) return -1; // 0 wraps around
+    return get_lowest_bit_from_map( map );
+}
+
+#endif /* __BITOPS_H__ */
@@ -16,34 +16,20 @@ static int get_locations_in_rows_cols_boxes( int candidate_mask, candidate_row_l
 //                                          SUDOKU_N_COLS col locations,
 //                                      and SUDOKU_N_BOXES box locations
 {
-    for ( int b = 0; b < SUDOKU_N_BOXES; ++b ) {
-        cbloc[b].n_cells = 0;
-        cbloc[b].cell_map = 0;
-    }
-
-    for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-        ccloc[c].n_rows = 0;
-        ccloc[c].row_map = 0;
-    }
+    int candidate = get_number_from_map( candidate_mask );
+    const uint16_t *row_maps = get_symbol_locations( LOCATE_BY_ROW, candidate );
+    const uint16_t *col_maps = get_symbol_locations( LOCATE_BY_COL, candidate );
+    const uint16_t *box_maps = get_symbol_locations( LOCATE_BY_BOX, candidate );
 
     int n_locations = 0;
-    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
-        crloc[r].n_cols = 0;
-        crloc[r].col_map = 0;
-
-        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            int b = get_surrounding_box( r, c );
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( cell->n_symbols > 1 && (cell->symbol_map & candidate_mask) ) {
-                ++crloc[r].n_cols;
-                crloc[r].col_map |= 1 << c;
-                ++ccloc[c].n_rows;
-                ccloc[c].row_map |= 1 << r;
-                ++cbloc[b].n_cells;
-                cbloc[b].cell_map |= 1 << get_cell_index_in_box( r, c );
-                ++n_locations;
-            }
-        }
+    for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {  // the index gives all maps
+        crloc[i].col_map = row_maps[i];
+        crloc[i].n_cols = get_n_bits_from_map( row_maps[i] );
+        ccloc[i].row_map = col_maps[i];
+        ccloc[i].n_rows = get_n_bits_from_map( col_maps[i] );
+        cbloc[i].cell_map = box_maps[i];
+        cbloc[i].n_cells = get_n_bits_from_map( box_maps[i] );
+        n_locations += crloc[i].n_cols;
     }
 // debug
     printf( "Symbol %c code %d (map 0x%03x) locations:\n",
@@ -66,12 +52,13 @@ static int get_locations_in_rows_cols_boxes( int candidate_mask, candidate_row_l
 
 static int get_candidate_map( void )
 {
+    const location_index_t *index = get_location_index( );
     int candidate_map = 0;
-    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
-        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( cell->n_symbols > 1 ) {
-                candidate_map |= cell->symbol_map;
+    for ( int symbol = 0; symbol < SUDOKU_N_SYMBOLS; ++symbol ) {
+        for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+            if ( index->rows[symbol][r] ) {
+                candidate_map |= 1 << symbol;
+                break;
             }
         }
     }
@@ -130,13 +117,13 @@ static bool locate_forbidden_candidates( chain_link_t *chain, int n_links,
         for ( int i = 0; i < n_prows; ++i ) {   // make up candidates and check if they contain the symbol
             for ( int j = 0; j < n_pcols; ++j ) {
                 if ( chain[prows[i].chain_offset].polarity != chain[pcols[j].chain_offset].polarity ) {
-                    sudoku_cell_t *cell = get_cell( prows[i].index, pcols[j].index );
-                    if ( cell->n_symbols > 1 && ( symbol_mask & cell->symbol_map ) ) {
+                    grid_cell_t cell = get_cell( prows[i].index, pcols[j].index );
+                    if ( get_cell_n_symbols( cell ) > 1 && ( symbol_mask & get_cell_map( cell ) ) ) {
                         hdesc->hints[n_hints].row = prows[i].index;
                         hdesc->hints[n_hints].col = pcols[j].index;
                         ++n_hints;
 
-                        if ( 2 == cell->n_symbols ) {
+                        if ( 2 == get_cell_n_symbols( cell ) ) {
                             hdesc->selection.row = prows[i].index;
                             hdesc->selection.col = pcols[j].index;
                         }
@@ -247,13 +234,13 @@ static bool find_chain_exclusions( chain_link_t *chain, int symbol_mask,
             for ( int seg2_index = seg2_beg; seg2_index <= seg2_end; ++ seg2_index ) {
                 if ( prev_seg2_polarity == chain[seg2_index].polarity ) continue;
 
-                sudoku_cell_t *cell;    // try and find cells with symbol at the intersection of rows/cols
+                grid_cell_t cell;      // try and find cells with symbol at the intersection of rows/cols
                 if ( ! is_cell_in_chain( chain, seg1_beg, seg1_end,
                                          chain[seg1_index].row, chain[seg2_index].col ) &&
                      ! is_cell_in_chain( chain, seg2_beg, seg2_end,
                                          chain[seg1_index].row, chain[seg2_index].col ) ) {
                     cell = get_cell( chain[seg1_index].row, chain[seg2_index].col );
-                    if ( cell->symbol_map & symbol_mask ) {
+                    if ( get_cell_map( cell ) & symbol_mask ) {
                         hdesc->hints[n_hints + hdesc->n_hints].row = chain[seg1_index].row;
                         hdesc->hints[n_hints + hdesc->n_hints].col = chain[seg2_index].col;
                         ++n_hints;
@@ -265,7 +252,7 @@ static bool find_chain_exclusions( chain_link_t *chain, int symbol_mask,
                      ! is_cell_in_chain( chain, seg2_beg, seg2_end,
                                          chain[seg2_index].row, chain[seg1_index].col ) ) {
                     cell = get_cell( chain[seg2_index].row, chain[seg1_index].col );
-                    if ( cell->symbol_map & symbol_mask ) {
+                    if ( get_cell_map( cell ) & symbol_mask ) {
                         hdesc->hints[n_hints + hdesc->n_hints].row = chain[seg2_index].row;
                         hdesc->hints[n_hints + hdesc->n_hints].col = chain[seg1_index].col;
                         ++n_hints;
@@ -483,8 +470,11 @@ static void setup_chain_hints( chain_link_t *chain, int symbol_mask, int n_links
     }
 }
 
-extern bool search_for_forbidding_chains( hint_desc_t *hdesc )
+extern int search_for_forbidding_chains( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+// return 0 if no forbidding chain, or the number of forbidding chains found,
+// at most one for each candidate symbol (see get_hints).
 {
+    int n_hints = 0;
     int candidate_map = get_candidate_map();
 
     candidate_row_location_t crloc[SUDOKU_N_ROWS];
@@ -528,15 +518,18 @@ extern bool search_for_forbidding_chains( hint_desc_t *hdesc )
             printf("    %d direct hints:\n", hdesc->n_hints );
             print_forbidden_candidates( hdesc );
             setup_chain_hints( chain, 1 << candidate, n_links, hdesc );
-            return true;
+            ++n_hints;
+            if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+            continue;
         }
         if ( process_weak_relations( chain, n_links, 1 << candidate, hdesc ) ) { 
             printf("    %d weak relation hints:\n", hdesc->n_hints );
             print_forbidden_candidates( hdesc );
             setup_chain_hints( chain, 1 << candidate, n_links, hdesc );
-            return true;
+            ++n_hints;
+            if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
         }
     }
-    return false;
+    return n_hints;
 }
 
@@ -1,4 +1,4 @@
 
 #include "hint.h"
 
-extern bool search_for_forbidding_chains( hint_desc_t *hdesc );
+extern int search_for_forbidding_chains( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
@@ -0,0 +1,178 @@
+/*
+  Sudoku whole grid candidate elimination
+*/
+#include <pthread.h>
+
+#include "elim.h"
+
+/*
+   Each pass computes for every row, column and box the map of solved symbols,
+   checks that no symbol is solved twice in the same unit, and removes solved
+   symbols from all unsolved cells at once. Passes are repeated until a pass
+   does not solve any new cell. The result is the same as removing symbols
+   one solved cell at a time, whatever the order.
+*/
+
+static bool eliminate_candidates_scalar( uint16_t *maps )
+{
+    while ( true ) {
+        uint16_t rows[SUDOKU_N_ROWS] = { 0 }, cols[SUDOKU_N_COLS] = { 0 },
+                 boxes[SUDOKU_N_BOXES] = { 0 };
+
+        for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+            uint16_t map = maps[i];
+            if ( map & (map - 1) ) continue;            // more than 1 candidate
+
+            int r = i / SUDOKU_N_COLS, c = i % SUDOKU_N_COLS, b = (r / 3) * 3 + c / 3;
+            if ( ( rows[r] | cols[c] | boxes[b] ) & map ) return false;
+            rows[r] |= map;
+            cols[c] |= map;
+            boxes[b] |= map;
+        }
+
+        bool solved = false;
+        for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+            uint16_t map = maps[i];
+            if ( 0 == ( map & (map - 1) ) ) continue;   // solved or empty
+
+            int r = i / SUDOKU_N_COLS, c = i % SUDOKU_N_COLS, b = (r / 3) * 3 + c / 3;
+            map &= ~( rows[r] | cols[c] | boxes[b] );
+            if ( 0 == map ) return false;
+            if ( 0 == ( map & (map - 1) ) ) solved = true;
+            maps[i] = map;
+        }
+        if ( ! solved ) return true;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+/*
+   AVX2 kernel: each grid row is held in one 256-bit register of 16 16-bit lanes,
+   organized as 4 64-bit chunks. Column c is in lane 4 * (c / 3) + c % 3, so that
+   the 3 columns of a box are in the same chunk, the 4th lane of each chunk and the
+   whole 4th chunk being always 0:
+
+        chunk 0         chunk 1         chunk 2         chunk 3
+    c0 c1 c2 0      c3 c4 c5 0      c6 c7 c8 0      0  0  0  0
+
+   Solved symbols in a row segment of a box are combined within a chunk, then
+   segments are combined across chunks for the whole row, and across 3 rows for
+   boxes. Columns are combined across the 9 row registers. Along the way, symbols
+   seen twice are accumulated in order to detect duplicates.
+*/
+#define LANE(_col)          (4 * ((_col) / 3) + (_col) % 3)
+
+#define AVX2 __attribute__((target("avx2")))
+
+// combine once/twice with the same values in partner lanes or chunks
+#define COMBINE( _once, _twice, _partner ) do {                         \
+        __m256i _po = _partner( _once ), _pt = _partner( _twice );      \
+        _twice = _mm256_or_si256( _mm256_or_si256( _twice, _pt ),       \
+                                  _mm256_and_si256( _once, _po ) );     \
+        _once = _mm256_or_si256( _once, _po );                          \
+    } while ( 0 )
+
+// lane i ^ 1, lane i ^ 2 (within a chunk), chunk i ^ 1, chunk i ^ 2
+#define LANE_1( _v )  _mm256_shufflehi_epi16( _mm256_shufflelo_epi16( _v, _MM_SHUFFLE(2,3,0,1) ), \
+                                              _MM_SHUFFLE(2,3,0,1) )
+#define LANE_2( _v )  _mm256_shuffle_epi32( _v, _MM_SHUFFLE(2,3,0,1) )
+#define CHUNK_1( _v ) _mm256_permute4x64_epi64( _v, _MM_SHUFFLE(2,3,0,1) )
+#define CHUNK_2( _v ) _mm256_permute4x64_epi64( _v, _MM_SHUFFLE(1,0,3,2) )
+
+static AVX2 bool eliminate_candidates_avx2( uint16_t *maps )
+{
+    uint16_t lanes[SUDOKU_N_ROWS][16] __attribute__((aligned(32))) = { { 0 } };
+    __m256i rows[SUDOKU_N_ROWS];
+
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            lanes[r][LANE(c)] = maps[r * SUDOKU_N_COLS + c];
+        }
+        rows[r] = _mm256_load_si256( (const __m256i *)lanes[r] );
+    }
+
+    const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16( 1 );
+    while ( true ) {
+        __m256i singles[SUDOKU_N_ROWS], solved[SUDOKU_N_ROWS];
+        __m256i row_placed[SUDOKU_N_ROWS], box_placed[SUDOKU_N_ROWS / 3];
+        __m256i col_once = zero, col_twice = zero, box_once = zero, box_twice = zero;
+        __m256i duplicates = zero;
+
+        for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+            __m256i m = rows[r];                        // 0 or 1 bit maps are solved
+            singles[r] = _mm256_cmpeq_epi16( _mm256_and_si256( m, _mm256_sub_epi16( m, one ) ), zero );
+            solved[r] = _mm256_and_si256( m, singles[r] );
+
+            col_twice = _mm256_or_si256( col_twice, _mm256_and_si256( col_once, solved[r] ) );
+            col_once = _mm256_or_si256( col_once, solved[r] );
+
+            __m256i once = solved[r], twice = zero;     // box segments in chunks
+            COMBINE( once, twice, LANE_1 );
+            COMBINE( once, twice, LANE_2 );
+
+            if ( 0 == r % 3 ) {                         // boxes over 3 consecutive rows
+                box_once = once;
+                box_twice = twice;
+            } else {
+                box_twice = _mm256_or_si256( _mm256_or_si256( box_twice, twice ),
+                                             _mm256_and_si256( box_once, once ) );
+                box_once = _mm256_or_si256( box_once, once );
+                if ( 2 == r % 3 ) {
+                    box_placed[r / 3] = box_once;
+                    duplicates = _mm256_or_si256( duplicates, box_twice );
+                }
+            }
+
+            COMBINE( once, twice, CHUNK_1 );            // whole row
+            COMBINE( once, twice, CHUNK_2 );
+            row_placed[r] = once;
+            duplicates = _mm256_or_si256( duplicates, twice );
+        }
+        duplicates = _mm256_or_si256( duplicates, col_twice );
+        if ( ! _mm256_testz_si256( duplicates, duplicates ) ) return false;
+
+        __m256i emptied = zero, new_singles = zero;
+        for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+            __m256i placed = _mm256_or_si256( _mm256_or_si256( row_placed[r], col_once ),
+                                              box_placed[r / 3] );
+            __m256i m = _mm256_andnot_si256( _mm256_andnot_si256( singles[r], placed ), rows[r] );
+
+            // cells that were solved or empty did not change: any new 0 or single is new
+            __m256i single = _mm256_cmpeq_epi16( _mm256_and_si256( m, _mm256_sub_epi16( m, one ) ), zero );
+            emptied = _mm256_or_si256( emptied, _mm256_andnot_si256( singles[r],
+                                                    _mm256_cmpeq_epi16( m, zero ) ) );
+            new_singles = _mm256_or_si256( new_singles, _mm256_andnot_si256( singles[r], single ) );
+            rows[r] = m;
+        }
+        if ( ! _mm256_testz_si256( emptied, emptied ) ) return false;
+        if ( _mm256_testz_si256( new_singles, new_singles ) ) break;
+    }
+
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        _mm256_store_si256( (__m256i *)lanes[r], rows[r] );
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            maps[r * SUDOKU_N_COLS + c] = lanes[r][LANE(c)];
+        }
+    }
+    return true;
+}
+#endif
+
+static bool (*eliminate_fct)( uint16_t *maps );
+static pthread_once_t eliminate_once = PTHREAD_ONCE_INIT;
+
+static void select_eliminate_fct( void )
+{
+    eliminate_fct = eliminate_candidates_scalar;
+#if defined(__x86_64__) || defined(__i386__)
+    if ( __builtin_cpu_supports( "avx2" ) ) eliminate_fct = eliminate_candidates_avx2;
+#endif
+}
+
+extern bool eliminate_candidates( uint16_t maps[SUDOKU_N_CELLS] )
+{
+    pthread_once( &eliminate_once, select_eliminate_fct );
+    return eliminate_fct( maps );
+}
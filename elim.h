@@ -0,0 +1,26 @@
+/*
+  sudoku elim.h
+
+  Suduku game: whole grid candidate elimination
+*/
+
+#ifndef __ELIM_H__
+#define __ELIM_H__
+
+#include <stdint.h>
+#include "sudoku.h"
+
+/* Given the symbol maps of all cells in a grid (cell index is row * SUDOKU_N_COLS + col),
+   remove from cells with multiple candidates all symbols already solved (single symbol
+   maps) in the same row, column or box, until no new solved cell appears. Empty cells
+   (map 0) are left untouched.
+
+   It returns false if the grid is invalid, that is if the same symbol is solved twice
+   in a row, column or box, or if a cell would be left without any candidate. In that
+   case maps may have been partially updated.
+
+   The implementation is chosen once at run time: a vectorized kernel if the processor
+   supports AVX2, or a scalar version otherwise. */
+extern bool eliminate_candidates( uint16_t maps[SUDOKU_N_CELLS] );
+
+#endif /* __ELIM_H__ */
@@ -0,0 +1,180 @@
+/*
+  Sudoku puzzle factory
+*/
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "sudoku.h"
+#include "solve.h"
+#include "pool.h"
+
+/*
+    A factory delivers puzzles of a requested level. Puzzles are generated and
+    rated by a number of producer threads, each one with its own random state,
+    and they are sorted by the thread calling the factory, as they come out of
+    the producers.
+
+    A rated puzzle that is not of the requested level is not thrown away: it is
+    kept in the queue of its own level, to be delivered first by a later request
+    for that level. The factory keeps its queues between requests.
+
+    Puzzles are dug down to minimal puzzles (about 24 givens), which are harder
+    on average than numbered games (31 to 36 givens), so that harder levels fill
+    quickly. Factory puzzles therefore differ from the numbered games given by
+    sudoku_pick_game, even at the same level.
+*/
+
+#define N_CANDIDATES    16      // puzzles rated but not yet sorted
+#define QUEUE_SIZE      64      // rated puzzles kept for each level
+
+typedef struct {
+    sudoku_grid_t   puzzle;
+    sudoku_level_t  level;
+} candidate_t;
+
+typedef struct {
+    sudoku_grid_t   puzzles[QUEUE_SIZE];
+    size_t          first, n;
+} level_queue_t;
+
+struct sudoku_factory {
+    pthread_mutex_t lock;               // protects candidates and stop
+    pthread_cond_t  not_empty, not_full;
+    candidate_t     candidates[N_CANDIDATES];
+    size_t          first, n;
+    bool            stop;
+
+    int             n_threads;
+    uint64_t        next_seed;          // each producer starts from a new seed
+
+    level_queue_t   queues[DIFFICULT];  // one queue per level, indexed by level - 1
+};
+
+typedef struct {
+    sudoku_factory_t    *factory;
+    random_state_t      random;
+} producer_t;
+
+static void *produce( void *arg )
+{
+    producer_t *producer = arg;
+    sudoku_factory_t *factory = producer->factory;
+
+    while ( true ) {
+        candidate_t candidate;
+        make_random_puzzle( &producer->random, 0, &candidate.puzzle, NULL );
+        candidate.level = sudoku_rate_puzzle( &candidate.puzzle, NULL );
+
+        pthread_mutex_lock( &factory->lock );
+        while ( N_CANDIDATES == factory->n && ! factory->stop ) {
+            pthread_cond_wait( &factory->not_full, &factory->lock );
+        }
+        if ( factory->stop ) {
+            pthread_mutex_unlock( &factory->lock );
+            break;
+        }
+        factory->candidates[(factory->first + factory->n) % N_CANDIDATES] = candidate;
+        ++factory->n;
+        pthread_cond_signal( &factory->not_empty );
+        pthread_mutex_unlock( &factory->lock );
+    }
+    return NULL;
+}
+
+static void get_candidate( sudoku_factory_t *factory, candidate_t *candidate )
+{
+    pthread_mutex_lock( &factory->lock );
+    while ( 0 == factory->n ) {
+        pthread_cond_wait( &factory->not_empty, &factory->lock );
+    }
+    *candidate = factory->candidates[factory->first];
+    factory->first = (factory->first + 1) % N_CANDIDATES;
+    --factory->n;
+    pthread_cond_signal( &factory->not_full );
+    pthread_mutex_unlock( &factory->lock );
+}
+
+static size_t get_queued( level_queue_t *queue, size_t n_puzzles, sudoku_grid_t *puzzles )
+{
+    size_t n = 0;
+    for ( ; n < n_puzzles && queue->n; ++n ) {
+        puzzles[n] = queue->puzzles[queue->first];
+        queue->first = (queue->first + 1) % QUEUE_SIZE;
+        --queue->n;
+    }
+    return n;
+}
+
+static void put_queued( level_queue_t *queue, const sudoku_grid_t *puzzle )
+{
+    if ( QUEUE_SIZE == queue->n ) return;       // queue full, drop puzzle
+    queue->puzzles[(queue->first + queue->n) % QUEUE_SIZE] = *puzzle;
+    ++queue->n;
+}
+
+extern sudoku_factory_t *sudoku_factory_new( int n_threads, unsigned int seed )
+{
+    sudoku_factory_t *factory = calloc( 1, sizeof(sudoku_factory_t) );
+    if ( NULL == factory ) return NULL;
+
+    pthread_mutex_init( &factory->lock, NULL );
+    pthread_cond_init( &factory->not_empty, NULL );
+    pthread_cond_init( &factory->not_full, NULL );
+    factory->n_threads = ( n_threads < 1 ) ? get_pool_default_n_workers( ) : n_threads;
+    factory->next_seed = seed;
+    return factory;
+}
+
+extern void sudoku_factory_free( sudoku_factory_t *factory )
+{
+    if ( NULL == factory ) return;
+
+    pthread_cond_destroy( &factory->not_full );
+    pthread_cond_destroy( &factory->not_empty );
+    pthread_mutex_destroy( &factory->lock );
+    free( factory );
+}
+
+extern size_t sudoku_factory_make( sudoku_factory_t *factory, sudoku_level_t level,
+                                   size_t n_puzzles, sudoku_grid_t *puzzles )
+{
+    if ( level < EASY || level > DIFFICULT ) return 0;
+
+    size_t n_made = get_queued( &factory->queues[level-1], n_puzzles, puzzles );
+    if ( n_made == n_puzzles ) return n_made;
+
+    producer_t *producers = malloc( factory->n_threads * sizeof(producer_t) );
+    pthread_t *threads = malloc( factory->n_threads * sizeof(pthread_t) );
+    int n_started = 0;
+
+    if ( producers && threads ) {
+        factory->stop = false;
+        for ( ; n_started < factory->n_threads; ++n_started ) {
+            producers[n_started].factory = factory;
+            set_random_state_seed( &producers[n_started].random, factory->next_seed++ );
+            if ( pthread_create( &threads[n_started], NULL, produce, &producers[n_started] ) ) break;
+        }
+    }
+
+    while ( n_started && n_made < n_puzzles ) {
+        candidate_t candidate;
+        get_candidate( factory, &candidate );
+
+        if ( candidate.level == level ) {
+            puzzles[n_made++] = candidate.puzzle;
+        } else {
+            put_queued( &factory->queues[candidate.level-1], &candidate.puzzle );
+        }
+    }
+
+    pthread_mutex_lock( &factory->lock );   // candidates left are kept for next time
+    factory->stop = true;
+    pthread_cond_broadcast( &factory->not_full );
+    pthread_mutex_unlock( &factory->lock );
+    while ( n_started-- ) {
+        pthread_join( threads[n_started], NULL );
+    }
+    free( threads );
+    free( producers );
+    return n_made;
+}
@@ -11,7 +11,7 @@
 
 #include "sudoku.h"
 #include "grid.h"
-#include "game.h"
+#include "session.h"
 #include "files.h"
 
 #define SUDOKU_SUCCESS 0    /**< For functions returning success */
@@ -20,10 +20,11 @@
 /* file syntax :
 
   # comment - can start anywhere in a line, stops at end of line.
-  L nnnnnn
+  L n [nnnn]
   T nnnnnn
   C c  R r  = v    x : v   x,y = v   x,y : v1, v2 , v3
   where 
+  n is the game level, optionally followed on the same line by its score
   nnnnnn is an integer number of seconds
   c, r, x, y, v are 1 digit in [1..9]
   = v is given symbol, at location (r,c)
@@ -37,7 +38,7 @@
 
   file:                       <expression>* <eof>
   eof:                        EOF
-  expression:                 <space> | <time> | <command> |
+  expression:                 <space> | <level> | <time> | <command> |
                               <fully-specified-assignment> |
                               <column-assignment> | <assignment>
 
@@ -46,6 +47,10 @@
   any-char:                   any ASCII char other than '\n' or '\r'.
   eol:                        '\n' | '\r'
 
+  level                       <level-prefix> <space>* <number> [ <blank> <number> ]
+  level-prefix                'L' | 'l'
+  blank                       ' ' | '\t' | ( <blank> <blank> )
+
   time                        <time-prefix> <space-value>
   time-prefix                 'T' | 't'
   space-value                 <value-space> | ( <space> <value-space> )
@@ -113,6 +118,21 @@ static sudoku_level_t parse_level( FILE *fd )
     return (sudoku_level_t)level;
 }
 
+static int parse_score( FILE *fd )
+// return the optional score following the level on the same line, or 0
+{
+    int c;
+    while ( ' ' == (c = getc(fd)) || '\t' == c );
+    ungetc( c, fd );
+    if ( c < '0' || c > '9' ) return 0;
+
+    int score;
+    if ( 1 != fscanf( fd, "%d", &score ) || score < 0 || score > SUDOKU_MAX_SCORE ) {
+        return 0;
+    }
+    return score;
+}
+
 static unsigned long parse_time( FILE *fd )
 {
     unsigned long time = 0;
@@ -123,7 +143,7 @@ static unsigned long parse_time( FILE *fd )
     return time;
 }
 
-static int cur_row = -1, cur_col = -1;
+static _Thread_local int cur_row = -1, cur_col = -1;
 static int parse_command( FILE *fd, int c )
 {
     int v = get_symbol( fd );
@@ -212,6 +232,7 @@ static int parse_file( FILE *fd )
 {
     unsigned long time = 0;
     sudoku_level_t level = 0;
+    int score = 0;
     int c;
     while ( EOF != (c = getc( fd )) ) {
         // printf("parsing %c\n", c );
@@ -225,6 +246,7 @@ static int parse_file( FILE *fd )
             skip_space( fd );
             level = parse_level( fd );
             if ( level < EASY || level > DIFFICULT )       return SUDOKU_FAILURE;
+            score = parse_score( fd );
             break;
 
         case 'T': case 't':
@@ -248,6 +270,7 @@ static int parse_file( FILE *fd )
 
     if (0 == level) return SUDOKU_FAILURE;
     set_game_level( level );
+    set_game_score( score );
     if ( 0 == time ) return SUDOKU_FAILURE;
     set_game_time( time );
     return SUDOKU_SUCCESS;
@@ -276,7 +299,7 @@ static int write_file( FILE *fd, const char *name )
     int r, c;
 
     fprintf(fd, "# Saved as %s\r\n\r\n", name);
-    fprintf(fd, "L %u\r\n", get_game_level());
+    fprintf(fd, "L %u %d\r\n", get_game_level(), get_game_score());
     fprintf(fd, "T %lu\r\n", get_game_duration());
 
     for ( r = 0; r < SUDOKU_N_ROWS; r ++ ) {
@@ -315,9 +338,9 @@ static int write_file( FILE *fd, const char *name )
     return 0;
 }
 
-extern int sudoku_save_file( const void *context, const char *name )
+extern int sudoku_save_file( sudoku_session_t *session, const char *name )
 {
-    (void)context;      // suppress unused paramater warning
+    set_session( session );
 
     FILE *fd = fopen( name, "w" );
     if ( NULL == fd ) {
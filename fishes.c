@@ -18,19 +18,10 @@ typedef struct {
 
 static void get_symbol_locations_in_set( locate_t by, int symbol_map, symbol_locations_t *sloc )
 {
+    const uint16_t *maps = get_symbol_locations( by, get_number_from_map( symbol_map ) );
     for ( int ref = 0; ref < SUDOKU_N_SYMBOLS; ++ ref ) {
-        sloc[ref].n_locations = 0;
-        sloc[ref].location_map = 0;
-
-        for ( int index = 0; index < SUDOKU_N_SYMBOLS; ++index ) {
-            cell_ref_t cr;
-            get_cell_ref_in_set( by, ref, index, &cr );
-            sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-            if ( cell->n_symbols > 1 && ( symbol_map & cell->symbol_map ) ) {
-                sloc[ref].location_map |= 1 << index;
-                ++sloc[ref].n_locations;
-            }
-        }
+        sloc[ref].location_map = maps[ref];
+        sloc[ref].n_locations = get_n_bits_from_map( maps[ref] );
     }
 }
 
@@ -64,9 +55,9 @@ static int set_X_wings_n_fish_hints( locate_t by, int symbol_mask, int n_refs, i
         for ( int i = 0 ; i < n_indexes; ++i ) {
             cell_ref_t cr;
             get_cell_ref_in_set( by, rc, indexes[i], &cr );
-            sudoku_cell_t *cell = get_cell( cr.row, cr.col );
+            grid_cell_t cell = get_cell( cr.row, cr.col );
 
-            if ( cell->n_symbols > 1 && ( cell->symbol_map & symbol_mask ) ) {
+            if ( get_cell_n_symbols( cell ) > 1 && ( get_cell_map( cell ) & symbol_mask ) ) {
                 if ( ! hint ) {
                     hdesc->hint_pencil = true;
                     hdesc->action = REMOVE;
@@ -75,7 +66,7 @@ static int set_X_wings_n_fish_hints( locate_t by, int symbol_mask, int n_refs, i
                     hint = true;
                 }
                 hdesc->hints[hdesc->n_hints++] = cr;
-                if ( 2 == cell->n_symbols ) {
+                if ( 2 == get_cell_n_symbols( cell ) ) {
                     hdesc->selection = cr;
                     new_single = true;
                 }
@@ -87,9 +78,9 @@ static int set_X_wings_n_fish_hints( locate_t by, int symbol_mask, int n_refs, i
             for ( int j = 0; j < n_indexes; ++j ) {
                 cell_ref_t cr;
                 get_cell_ref_in_set( by, refs[i], indexes[j], &cr );
-                sudoku_cell_t *cell = get_cell( cr.row, cr.col );
+                grid_cell_t cell = get_cell( cr.row, cr.col );
 
-                if ( cell->n_symbols > 1 && ( cell->symbol_map & symbol_mask ) ) {
+                if ( get_cell_n_symbols( cell ) > 1 && ( get_cell_map( cell ) & symbol_mask ) ) {
                     hdesc->triggers[hdesc->n_triggers] = cr;
                     hdesc->flavors[hdesc->n_triggers] = REGULAR_TRIGGER | PENCIL;
                     ++hdesc->n_triggers;
@@ -184,9 +175,11 @@ static int search_for_X_wings_n_fish_hints( locate_t by, int symbol_map,
     return -1;
 }
 
-extern bool check_X_wings_Swordfish( hint_desc_t *hdesc )
-// return 0 if no useful hint, 1 if some hints or 2 if at least one hint leads to a new single
+extern int check_X_wings_Swordfish( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+// return 0 if no useful hint, or the number of hints, at most one for each symbol
+// in rows and one in columns (see get_hints).
 {
+    int n_hints = 0;
     for ( int symbol = 0; symbol < SUDOKU_N_SYMBOLS; ++symbol ) {
 
         int symbol_map = 1 << symbol;
@@ -198,13 +191,19 @@ extern bool check_X_wings_Swordfish( hint_desc_t *hdesc )
         // 1. search for X-Wing, Swordfish or Jellyfish in rows
         res = search_for_X_wings_n_fish_hints( LOCATE_BY_ROW, symbol_map,
                                                row_sloc, hdesc );
-        if ( res != -1 ) return true;
+        if ( res != -1 ) {
+            ++n_hints;
+            if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+            get_symbol_locations_in_set( LOCATE_BY_COL, symbol_map, col_sloc );
+        }
  
         // 2. search for X-Wing, Swordfish or Jellyfish in columns
         res = search_for_X_wings_n_fish_hints( LOCATE_BY_COL, symbol_map,
                                                col_sloc, hdesc );
-        if ( res != -1 ) return true;
+        if ( res != -1 ) {
+            ++n_hints;
+            if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+        }
     }
-    return false;
+    return n_hints;
 }
-
@@ -1,4 +1,4 @@
 
 #include "hint.h"
 
-extern bool check_X_wings_Swordfish( hint_desc_t *hdesc );
+extern int check_X_wings_Swordfish( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
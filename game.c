@@ -10,9 +10,8 @@
 #include <stdio.h>
 #include <time.h>
 
-#include "grdstk.h"
+#include "session.h"
 #include "grid.h"
-#include "game.h"
 
 //#include "files.h"
 //#include "rand.h"
@@ -66,43 +65,44 @@
     bookmark (if it exists). However bookmark2 is still in the mark stack, and after a
     redo it will reappear as the new top bookmark.    
 */
-static int  redoLevel = 0;
-
-static int  markLevel = 0;
-static int  topMark = 0;
-
-static stack_pointer_t markStack[ NB_MARKS ];
+static inline game_state_t *get_game_state( void )
+{
+    return &get_session()->game;
+}
 
 static void cancel_redo( void )
 {
-    redoLevel = 0;
-    topMark = markLevel;
+    game_state_t *state = get_game_state( );
+    state->redoLevel = 0;
+    state->topMark = state->markLevel;
 }
 
 static void add_to_redo_level( int val )
 {
+    game_state_t *state = get_game_state( );
     SUDOKU_ASSERT( val > 0 );
-    redoLevel += val;
+    state->redoLevel += val;
 }
 
 extern bool is_redo_possible( void ) // exported to sudoku.c
 {
-    return redoLevel > 0;
+    return get_game_state( )->redoLevel > 0;
 }
 
 // returns 0 if no redo possible, 1 if redo done, 2 if redo done and back to last mark
 extern int redo( void ) // exported to sudoku_redo in sudoku.c
 {
-    if ( redoLevel > 0 ) {
-        printf( "Redo: decrementing redoLevel (was %d before) \n", redoLevel );
-        --redoLevel;
+    game_state_t *state = get_game_state( );
+    if ( state->redoLevel > 0 ) {
+        printf( "Redo: decrementing redoLevel (was %d before) \n", state->redoLevel );
+        --state->redoLevel;
         push();     // actually back to next grid in stack
 
         printf( "Checking sp %u @markLevel %d topMark %d (val %d)\n",
-                get_sp(), markLevel, topMark, markStack[ markLevel ] );
-        if ( topMark > markLevel && markStack[ markLevel ] == get_sp() ) {
-            markLevel++;
-            printf("Restored lastMark @level %d\n", markLevel );
+                get_sp(), state->markLevel, state->topMark, state->markStack[ state->markLevel ] );
+        if ( state->topMark > state->markLevel && state->markStack[ state->markLevel ] == get_sp() ) {
+            state->markLevel++;
+            printf("Restored lastMark @level %d\n", state->markLevel );
             return 2;
         }
         return 1;
@@ -112,29 +112,31 @@ extern int redo( void ) // exported to sudoku_redo in sudoku.c
 
 static void erase_all_bookmarks( void )
 {
-    markLevel = topMark = 0;
+    game_state_t *state = get_game_state( );
+    state->markLevel = state->topMark = 0;
     cancel_redo();
 }
 
 extern int get_bookmark_number( void )   // exported to sudoku.c
 {
-    return markLevel;
+    return get_game_state( )->markLevel;
 }
 
 extern int new_bookmark( void )   // exported to sudoku_mark_state in sudoku.c
 {
-    if ( markLevel == NB_MARKS ) return 0;
+    game_state_t *state = get_game_state( );
+    if ( state->markLevel == NB_MARKS ) return 0;
 
-    printf( "Mark: markLevel %d\n", markLevel);
-    for ( int i = 0; i <= markLevel; ++i ) {
-        printf ("   @%d mark value is %d\n", i, markStack[ i ]);
+    printf( "Mark: markLevel %d\n", state->markLevel);
+    for ( int i = 0; i <= state->markLevel; ++i ) {
+        printf ("   @%d mark value is %d\n", i, state->markStack[ i ]);
     }
     
-    markStack[ markLevel ] = get_sp();
-    printf(" added sp %d @markLevel %d\n", get_sp(), markLevel );
-    set_low_water_mark( markStack[ markLevel ] );
-    topMark = ++markLevel;
-    return markLevel;
+    state->markStack[ state->markLevel ] = get_sp();
+    printf(" added sp %d @markLevel %d\n", get_sp(), state->markLevel );
+    set_low_water_mark( state->markStack[ state->markLevel ] );
+    state->topMark = ++state->markLevel;
+    return state->markLevel;
 }
 
 /* check if the current grid is the same as the last bookmark.
@@ -145,11 +147,12 @@ extern int new_bookmark( void )   // exported to sudoku_mark_state in sudoku.c
 */
 extern int check_if_at_bookmark( void )   // exported to sudoku.c
 {
+    game_state_t *state = get_game_state( );
 printf( "check_if_at_bookmark: sp=%u\n", get_sp() );
-    if ( markLevel > 0 ) {
-        SUDOKU_ASSERT( markLevel <= NB_MARKS );
-        SUDOKU_ASSERT( markLevel <= topMark );
-        return ( (get_sp() == markStack[ markLevel-1]) ? 2 : 1 );
+    if ( state->markLevel > 0 ) {
+        SUDOKU_ASSERT( state->markLevel <= NB_MARKS );
+        SUDOKU_ASSERT( state->markLevel <= state->topMark );
+        return ( (get_sp() == state->markStack[ state->markLevel-1]) ? 2 : 1 );
     }
     return 0;
 }
@@ -162,13 +165,14 @@ extern bool is_undo_possible( void )
 // return 0 if nothing to undo, 1 if undone, 2 if undone and last bookmark is removed as well.
 extern int undo( void ) // exported to sudoku_undo in sudoku.c
 {
+    game_state_t *state = get_game_state( );
     if ( -1 != pop( ) ) {
-        printf( "undo: incrementing redoLevel (was %d before) \n", redoLevel );
-        ++redoLevel;
-        printf("Checking sp %u @markLevel %d\n", get_sp(), markLevel );
-        if ( markLevel > 0 && get_sp() < markStack[ markLevel-1] ) {
-            markLevel--;
-            printf("Undone lastmark (new markLevel %d)\n", markLevel );
+        printf( "undo: incrementing redoLevel (was %d before) \n", state->redoLevel );
+        ++state->redoLevel;
+        printf("Checking sp %u @markLevel %d\n", get_sp(), state->markLevel );
+        if ( state->markLevel > 0 && get_sp() < state->markStack[ state->markLevel-1] ) {
+            state->markLevel--;
+            printf("Undone lastmark (new markLevel %d)\n", state->markLevel );
             return 2;
         }
         return 1;
@@ -184,77 +188,93 @@ extern int undo( void ) // exported to sudoku_undo in sudoku.c
 */
 extern int return_to_last_bookmark( void )  // exported to sudoku_back_to_mark in sudoku.c
 {
-    SUDOKU_ASSERT( markLevel <= NB_MARKS );
-    SUDOKU_ASSERT( markLevel <= topMark );
+    game_state_t *state = get_game_state( );
+    SUDOKU_ASSERT( state->markLevel <= NB_MARKS );
+    SUDOKU_ASSERT( state->markLevel <= state->topMark );
 
-    if ( markLevel > 0 ) {
+    if ( state->markLevel > 0 ) {
 
         stack_pointer_t csp = get_sp( );
-        stack_pointer_t nsp = markStack[ markLevel-1 ];
+        stack_pointer_t nsp = state->markStack[ state->markLevel-1 ];
         if ( csp > nsp ) {
-            topMark = --markLevel;
+            state->topMark = --state->markLevel;
             add_to_redo_level( csp - nsp );
             set_sp( nsp );
-            return markLevel;
+            return state->markLevel;
         }
     }
     return -1;
 }
 
-static sudoku_level_t game_level;
-static time_t play_started;
-static unsigned long already_played;
-
 extern void set_game_level( sudoku_level_t level )
 {
+    game_state_t *state = get_game_state( );
     if ( level < EASY || level > DIFFICULT ) {
         printf("Invalid game level %d\n", level );
         exit(1);
     }
-    game_level = level;
+    state->game_level = level;
 }
 
 extern sudoku_level_t get_game_level( void )
 {
-    return game_level;
+    return get_game_state( )->game_level;
+}
+
+extern void set_game_score( int score )
+{
+    get_game_state( )->game_score = score;
+}
+
+extern int get_game_score( void )
+{
+    return get_game_state( )->game_score;
+}
+
+extern void set_game_solution( const sudoku_grid_t *solution )
+{
+    game_state_t *state = get_game_state( );
+    state->solution_known = ( NULL != solution );
+    if ( solution ) state->solution = *solution;
+}
+
+extern const sudoku_grid_t *get_game_solution( void )
+{
+    game_state_t *state = get_game_state( );
+    return ( state->solution_known ) ? &state->solution : NULL;
 }
 
 extern void set_game_time( unsigned long duration )
 {
-    time( &play_started );
-    already_played = duration;
+    game_state_t *state = get_game_state( );
+    time( &state->play_started );
+    state->already_played = duration;
 }
 
 extern unsigned long get_game_duration( void )
 {
+    game_state_t *state = get_game_state( );
     double diff;
     unsigned long duration;
     time_t end_time;
 
     time ( &end_time );
-    diff = difftime( end_time, play_started );
-    duration = (unsigned long)diff + already_played;
+    diff = difftime( end_time, state->play_started );
+    duration = (unsigned long)diff + state->already_played;
     return duration;
 }
 
-typedef struct {
-    stack_pointer_t sp, lwm;
-    stack_pointer_t markStack[ NB_MARKS ];
-    int  redoLevel;
-    int  markLevel;
-    int  topMark;
-} game_t;
-
 extern void *save_current_game( void )
 {
-    static game_t current_game;
-    current_game.sp = get_sp();
-    current_game.lwm = get_low_water_mark();
-    memcpy( current_game.markStack, markStack, sizeof( stack_pointer_t ) * NB_MARKS );
-    current_game.redoLevel = redoLevel;
-    current_game.markLevel = markLevel;
-    current_game.topMark = topMark;
-    return (void *)&current_game;
+    game_state_t *state = get_game_state( );
+    game_t *saved_game = &state->saved_game;
+    saved_game->sp = get_sp();
+    saved_game->lwm = get_low_water_mark();
+    memcpy( saved_game->markStack, state->markStack, sizeof( stack_pointer_t ) * NB_MARKS );
+    saved_game->redoLevel = state->redoLevel;
+    saved_game->markLevel = state->markLevel;
+    saved_game->topMark = state->topMark;
+    return (void *)saved_game;
 }
 
 extern void *save_current_game_for_solving( void )
@@ -269,11 +289,12 @@ extern void *save_current_game_for_solving( void )
 
 extern void restore_saved_game( void *game )
 {
+    game_state_t *state = get_game_state( );
     game_t *previous_game_p = (game_t *)game;
-    memcpy( markStack, previous_game_p->markStack, sizeof( stack_pointer_t ) * NB_MARKS );
-    redoLevel = previous_game_p->redoLevel;
-    markLevel = previous_game_p->markLevel;
-    topMark = previous_game_p->topMark;
+    memcpy( state->markStack, previous_game_p->markStack, sizeof( stack_pointer_t ) * NB_MARKS );
+    state->redoLevel = previous_game_p->redoLevel;
+    state->markLevel = previous_game_p->markLevel;
+    state->topMark = previous_game_p->topMark;
 
     set_low_water_mark( previous_game_p->lwm );
     set_sp( previous_game_p->sp );
@@ -292,7 +313,11 @@ extern void reset_game( void )
 {
     reset_stack( );
     empty_grid( get_current_stack_index( ) );
+    clear_grid_attributes( );
     erase_all_bookmarks();
+    set_game_score( 0 );                    // unknown until set by the caller
+    set_game_solution( NULL );
+    clear_solve_path( &get_session()->path );
 }
 
 extern void start_game( void )
@@ -324,6 +349,7 @@ extern void game_new_empty_grid( void )     // save current grid and create a ne
     stack_index_t csi = push();
 
     empty_grid( csi );
+    clear_grid_attributes( );
     cancel_redo();                          // no redo since stack is different
 }
 
@@ -7,7 +7,34 @@
 #ifndef __GAME_H__
 #define __GAME_H__
 
+#include <time.h>
 #include "sudoku.h"
+#include "stack.h"
+
+/* A game saved by save_current_game, to be restored later */
+typedef struct {
+    stack_pointer_t sp, lwm;
+    stack_pointer_t markStack[ NB_MARKS ];
+    int  redoLevel;
+    int  markLevel;
+    int  topMark;
+} game_t;
+
+/* The state of a game, kept in its session (see session.h) */
+typedef struct {
+    int             redoLevel;
+    int             markLevel;
+    int             topMark;
+    stack_pointer_t markStack[ NB_MARKS ];
+    game_t          saved_game;
+
+    sudoku_level_t  game_level;
+    int             game_score;             // 0 if unknown
+    bool            solution_known;         // if the puzzle has a unique solution
+    sudoku_grid_t   solution;
+    time_t          play_started;
+    unsigned long   already_played;
+} game_state_t;
 
 extern int  new_bookmark( void );
 extern int  get_bookmark_number( void );
@@ -44,5 +71,11 @@ extern unsigned long get_game_duration( void );
 
 extern void set_game_level( sudoku_level_t level );
 extern sudoku_level_t get_game_level( void );
+extern void set_game_score( int score );
+extern int get_game_score( void );
+
+// the unique solution of the game puzzle, NULL if not known
+extern void set_game_solution( const sudoku_grid_t *solution );
+extern const sudoku_grid_t *get_game_solution( void );
 
 #endif /* __GAME_H__ */
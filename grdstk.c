@@ -0,0 +1,283 @@
+/*
+  Sudoku grid storage in stack
+*/
+#include <stdlib.h>
+#include <string.h>
+#include "session.h"
+
+/*
+  Only the grid at the current stack pointer is kept in full, in current. Any
+  other grid in stack is kept as a step: the cells that changed from the grid
+  just below, and the selection and grid hash before and after. Every CHECKPOINT_INTERVAL
+  stack pointers, a step also keeps a full copy of its grid, so that moving to
+  any stack pointer never requires replaying more than CHECKPOINT_INTERVAL / 2
+  steps, whatever the distance from the current grid.
+
+  The current grid is modified in place without moving the stack pointer, for
+  example when selecting a cell or when showing a hint. Those changes are only
+  recorded, in the current step and in the step above if any, when the stack
+  pointer moves away. Until then, shadow is the current grid as recorded in
+  steps.
+
+  Steps are kept in an array indexed by stack pointer, which grows as needed,
+  so that the history is only limited by memory.
+*/
+#define CHECKPOINT_INTERVAL 32
+
+typedef struct {
+    uint8_t             cell;           // row * SUDOKU_N_COLS + col
+    grid_cell_t         before, after;
+} cell_change_t;
+
+typedef struct grid_step {
+    cell_change_t       *changes;       // from the grid just below
+    int                 n_changes;
+    int8_t              row_before, col_before, row_after, col_after;
+    grid_hash_t         hash_before, hash_after;
+    grid_state_t        *checkpoint;    // full grid, every CHECKPOINT_INTERVAL steps
+} grid_step_t;
+
+static inline grid_stack_t *get_grid_stack( void )
+{
+    return &get_session()->grids;
+}
+
+static inline bool is_checkpoint( stack_pointer_t sp )
+{
+    return 0 == ( sp - 1 ) % CHECKPOINT_INTERVAL;
+}
+
+static bool is_same_state( const grid_state_t *g1, const grid_state_t *g2 )
+{
+    if ( g1->hash != g2->hash || g1->row != g2->row || g1->col != g2->col ) return false;
+    return 0 == memcmp( g1->cells, g2->cells, sizeof(g1->cells) );
+}
+
+static void *checked_realloc( void *ptr, size_t size )
+{
+    void *new_ptr = realloc( ptr, size );
+    if ( NULL == new_ptr ) {
+        fprintf( stderr, "sudoku: out of memory for undo stack\n" );
+        abort( );
+    }
+    return new_ptr;
+}
+
+// apply step to grid, going up if forward, or down to the grid below otherwise
+static void replay_step( grid_state_t *grid, const grid_step_t *step, bool forward )
+{
+    for ( int i = 0; i < step->n_changes; i++ ) {
+        const cell_change_t *change = &step->changes[i];
+        grid->cells[ change->cell / SUDOKU_N_COLS ][ change->cell % SUDOKU_N_COLS ] =
+                                        ( forward ) ? change->after : change->before;
+    }
+    grid->row = ( forward ) ? step->row_after : step->row_before;
+    grid->col = ( forward ) ? step->col_after : step->col_before;
+    grid->hash = ( forward ) ? step->hash_after : step->hash_before;
+}
+
+// record in step the changes from grid below to grid
+static void record_step( grid_step_t *step, const grid_state_t *below, const grid_state_t *grid )
+{
+    cell_change_t changes[ SUDOKU_N_CELLS ];
+    int n_changes = 0;
+    for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
+            if ( below->cells[r][c] == grid->cells[r][c] ) continue;
+
+            cell_change_t *change = &changes[ n_changes++ ];
+            change->cell = (uint8_t)(r * SUDOKU_N_COLS + c);
+            change->before = below->cells[r][c];
+            change->after = grid->cells[r][c];
+        }
+    }
+    if ( n_changes != step->n_changes ) {   // keep only what is needed
+        if ( n_changes ) {
+            step->changes = checked_realloc( step->changes, n_changes * sizeof(cell_change_t) );
+        } else {
+            free( step->changes );
+            step->changes = NULL;
+        }
+        step->n_changes = n_changes;
+    }
+    if ( n_changes ) {
+        memcpy( step->changes, changes, n_changes * sizeof(cell_change_t) );
+    }
+    step->row_before = below->row;
+    step->col_before = below->col;
+    step->row_after = grid->row;
+    step->col_after = grid->col;
+    step->hash_before = below->hash;
+    step->hash_after = grid->hash;
+}
+
+// rebuild the recorded grid at sp, from shadow or from the closest checkpoint
+static void rebuild_grid( grid_stack_t *grids, grid_state_t *grid, stack_pointer_t sp )
+{
+    SUDOKU_ASSERT( sp > 0 && sp <= grids->top_step );
+    stack_pointer_t from = sp - ( sp - 1 ) % CHECKPOINT_INTERVAL;
+    if ( from + CHECKPOINT_INTERVAL <= grids->top_step &&
+         from + CHECKPOINT_INTERVAL - sp < sp - from ) {
+        from += CHECKPOINT_INTERVAL;            // next checkpoint is closer
+    }
+    stack_pointer_t distance = ( sp > from ) ? sp - from : from - sp;
+
+    stack_pointer_t current_sp = grids->current_sp;
+    if ( current_sp <= grids->top_step &&
+         ( ( sp > current_sp ) ? sp - current_sp : current_sp - sp ) < distance ) {
+        *grid = grids->shadow;
+        from = current_sp;
+    } else {
+        *grid = *grids->steps[from].checkpoint;
+    }
+    for ( ; from > sp; --from ) {
+        replay_step( grid, &grids->steps[from], false );
+    }
+    while ( from < sp ) {
+        replay_step( grid, &grids->steps[++from], true );
+    }
+}
+
+// record the changes made in place in current grid
+static void commit_current_grid( grid_stack_t *grids )
+{
+    stack_pointer_t current_sp = grids->current_sp;
+    grid_state_t *current = &grids->current.state;
+    if ( current_sp > grids->top_step || is_same_state( current, &grids->shadow ) ) return;
+
+    grid_state_t grid;
+    if ( current_sp < grids->top_step ) {   // grid above does not change
+        grid = grids->shadow;
+        replay_step( &grid, &grids->steps[current_sp + 1], true );
+        record_step( &grids->steps[current_sp + 1], current, &grid );
+    }
+    if ( current_sp > 1 ) {                 // nor does grid below
+        grid = grids->shadow;
+        replay_step( &grid, &grids->steps[current_sp], false );
+        record_step( &grids->steps[current_sp], &grid, current );
+    }
+    if ( grids->steps[current_sp].checkpoint ) {
+        *grids->steps[current_sp].checkpoint = *current;
+    }
+    grids->shadow = *current;
+}
+
+extern stacked_grid_t *get_stacked_grid( void )
+{
+    grid_stack_t *grids = get_grid_stack( );
+    stack_pointer_t sp = get_sp( );
+    if ( sp != grids->current_sp ) {
+        commit_current_grid( grids );
+        if ( sp <= grids->top_step ) {
+            rebuild_grid( grids, &grids->current.state, sp );
+            SUDOKU_ASSERT( grids->current.state.hash ==
+                           compute_grid_hash( grids->current.state.cells ) );
+            build_location_index( grids->current.state.cells, &grids->current.index );
+            grids->shadow = grids->current.state;
+        }                       // else a new grid is about to be written at sp
+        grids->current_sp = sp;
+    }
+    return &grids->current;
+}
+
+// get a copy of the grid at sp, including changes made in place if current
+static void get_grid_state( grid_stack_t *grids, grid_state_t *grid, stack_pointer_t sp )
+{
+    if ( sp == grids->current_sp ) {
+        *grid = grids->current.state;
+    } else {
+        commit_current_grid( grids );
+        rebuild_grid( grids, grid, sp );
+    }
+}
+
+// make grid the new grid at sp, dismissing all grids above sp
+static void write_grid( grid_stack_t *grids, stack_pointer_t sp, const grid_state_t *grid, bool same_index )
+{
+    SUDOKU_ASSERT( sp > 0 );
+    commit_current_grid( grids );
+
+    if ( sp >= grids->n_steps ) {
+        stack_pointer_t n = ( grids->n_steps ) ? grids->n_steps : CHECKPOINT_INTERVAL;
+        while ( n <= sp ) n *= 2;
+        grids->steps = checked_realloc( grids->steps, n * sizeof(grid_step_t) );
+        memset( &grids->steps[grids->n_steps], 0, ( n - grids->n_steps ) * sizeof(grid_step_t) );
+        grids->n_steps = n;
+    }
+
+    grid_step_t *step = &grids->steps[sp];
+    if ( sp > 1 ) {
+        SUDOKU_ASSERT( sp - 1 <= grids->top_step );
+        grid_state_t below;
+        if ( sp - 1 == grids->current_sp ) {
+            below = grids->shadow;
+        } else {
+            rebuild_grid( grids, &below, sp - 1 );
+        }
+        record_step( step, &below, grid );
+    } else {
+        free( step->changes );
+        step->changes = NULL;
+        step->n_changes = 0;
+    }
+    if ( is_checkpoint( sp ) ) {
+        if ( NULL == step->checkpoint ) {
+            step->checkpoint = checked_realloc( NULL, sizeof(grid_state_t) );
+        }
+        *step->checkpoint = *grid;
+    }
+    grids->top_step = sp;                          // steps above are not valid anymore
+
+    grids->current.state = *grid;
+    if ( ! same_index ) {
+        build_location_index( grids->current.state.cells, &grids->current.index );
+    }
+    grids->shadow = grids->current.state;
+    grids->current_sp = sp;
+}
+
+extern void free_grid_stack( grid_stack_t *grids )
+{
+    for ( stack_pointer_t sp = 0; sp < grids->n_steps; sp++ ) {
+        free( grids->steps[sp].changes );
+        free( grids->steps[sp].checkpoint );
+    }
+    free( grids->steps );
+    memset( grids, 0, sizeof(grid_stack_t) );
+}
+
+// empty_grid makes an empty grid with no selection in the current state
+extern void empty_grid( stack_index_t csi )
+{
+    grid_stack_t *grids = get_grid_stack( );
+    grid_state_t grid;
+    memset( &grid, 0, sizeof(grid_state_t) );     // empty grid hash is 0
+    grid.row = grid.col = -1;
+    write_grid( grids, (stack_pointer_t)csi, &grid, false );
+}
+
+// replace grid at index d with the one at index s
+extern void copy_grid( stack_index_t d, stack_index_t s )
+{
+    grid_stack_t *grids = get_grid_stack( );
+    grid_state_t grid;
+    get_grid_state( grids, &grid, (stack_pointer_t)s );
+    write_grid( grids, (stack_pointer_t)d, &grid, (stack_pointer_t)s == grids->current_sp );
+}
+
+extern void copy_fill_grid( stack_index_t csi, stack_index_t psi )
+{
+    grid_stack_t *grids = get_grid_stack( );
+    grid_state_t grid;
+    get_grid_state( grids, &grid, (stack_pointer_t)psi );
+    for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
+            if ( get_cell_map( grid.cells[r][c] ) ) {
+                continue;           // don't touch cells with symbols
+            }                       // automatically populate for solving
+            grid.cells[r][c] = SUDOKU_SYMBOL_MASK;
+            grid.hash ^= get_map_hash( r * SUDOKU_N_COLS + c, SUDOKU_SYMBOL_MASK );
+        }
+    }
+    write_grid( grids, (stack_pointer_t)csi, &grid, false );
+}
@@ -5,8 +5,40 @@
 /*
     Sudoku grid storage in stack
 */
+#include "grid.h"
 #include "stack.h"
 
+/* A grid state is what is saved in stack for each game: cells and selection,
+   with the hash of cells, so that the hash comes back with the grid */
+typedef struct {
+    grid_hash_t         hash;
+    grid_cell_t         cells[ SUDOKU_N_ROWS ][ SUDOKU_N_COLS ];
+    int8_t              row, col;           // selection, -1 if none
+} grid_state_t;
+
+/* The grid at the current stack pointer is the only one kept in full, with
+   the location index of its candidates. It can be modified in place. */
+typedef struct {
+    grid_state_t        state;
+    location_index_t    index;
+} stacked_grid_t;
+
+/* All grids in stack of a game, kept in its session (see session.h) */
+typedef struct {
+    struct grid_step    *steps;         // indexed by stack pointer
+    stack_pointer_t     n_steps;        // allocated steps
+    stack_pointer_t     top_step;       // last recorded step, 0 if none
+    stack_pointer_t     current_sp;     // stack pointer of current grid
+    stacked_grid_t      current;
+    grid_state_t        shadow;         // current grid as recorded in steps
+} grid_stack_t;
+
+// free all grids in stack
+extern void free_grid_stack( grid_stack_t *grids );
+
+// return the grid at the current stack pointer, rebuilt if the stack pointer moved
+extern stacked_grid_t *get_stacked_grid( void );
+
 // make the grid at index d empty
 extern void empty_grid( stack_index_t d );
 
@@ -1,168 +1,186 @@
 
 #include <string.h>
 #include "grid.h"
-#include "stack.h"
+#include "session.h"
+#include "elim.h"
+#include "units.h"
 
 /*
   A grid is a snapshot of a game state at a given time. It is made of:
-  - the current cell values, kept in cellArray[ stack_index ]
-  - the current selection kept in rowArray[ stack_index ] and
-                                  colArray[ stack_index ]
-
-  The current game state is kept in cells and selection array, stored
-  in a grid stack, so that it is always possible to undo an operation.
-  The game stack management is in game.c, whereas grid.c only contains
-  grid and selection operations.
+  - the current cell values
+  - the current selection
+  - the current candidate locations
+
+  The current game state is kept in a grid stack (see grdstk.c), so that it
+  is always possible to undo an operation. The game stack management is in
+  game.c, whereas grid.c only contains grid and selection operations on the
+  grid at the current stack pointer.
 */
-static sudoku_cell_t cellArray [ MAX_DEPTH ] [ SUDOKU_N_ROWS ] [ SUDOKU_N_COLS ];
-static int  rowArray[ MAX_DEPTH ], colArray[ MAX_DEPTH ];
 
-// empty_grid makes an empty grid with no selection in the current state
-extern void empty_grid( stack_index_t csi )
+/*
+  A thread can also work on a private grid, out of the stack, for instance to
+  rate a puzzle from any thread: as long as it is set, all cell operations in
+  that thread apply to the private grid instead of the current grid in stack.
+*/
+static _Thread_local private_grid_t *private_grid;
+
+static inline grid_cell_t (*get_current_cells( void ))[ SUDOKU_N_COLS ]
+{
+    if ( private_grid ) return private_grid->cells;
+    return get_stacked_grid( )->state.cells;
+}
+
+static inline location_index_t *get_current_index( void )
+{
+    if ( private_grid ) return &private_grid->index;
+    return &get_stacked_grid( )->index;
+}
+
+static inline grid_hash_t *get_current_hash( void )
 {
+    if ( private_grid ) return &private_grid->hash;
+    return &get_stacked_grid( )->state.hash;
+}
+
+// rendering attributes are only kept for the game grid, never for a private grid
+static inline uint8_t (*get_current_attributes( void ))[ SUDOKU_N_COLS ]
+{
+    return get_session( )->attributes.cells;
+}
+
+extern const location_index_t * get_location_index( void )
+{
+    return get_current_index( );
+}
+
+// toggle the location of the symbols in map for the cell at row, col
+static void toggle_locations( location_index_t *index, int row, int col, int map )
+{
+    int cell = row * SUDOKU_N_COLS + col;
+    int box = cell_units[ cell ][ UNIT_BOX ];
+    int in_box = cell_unit_indexes[ cell ][ UNIT_BOX ];
+    while ( map ) {
+        int symbol = extract_bit_from_map( &map );
+        index->rows[symbol][row] ^= 1 << col;
+        index->cols[symbol][col] ^= 1 << row;
+        index->boxes[symbol][box] ^= 1 << in_box;
+    }
+}
+
+static inline int get_penciled_map( grid_cell_t cell )
+{
+    int map = get_cell_map( cell );
+    return ( map & ( map - 1 ) ) ? map : 0;     // more than 1 symbol
+}
+
+extern void build_location_index( grid_cell_t (*cells)[ SUDOKU_N_COLS ], location_index_t *index )
+{
+    memset( index, 0, sizeof(location_index_t) );
     for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
         for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            cellArray[csi][r][c].state = 0;
-            cellArray[csi][r][c].symbol_map = 0;
-            cellArray[csi][r][c].n_symbols = 0;
+            toggle_locations( index, r, c, get_penciled_map( cells[r][c] ) );
         }
     }
-    rowArray[ csi ] = colArray[ csi ] = -1;
 }
 
-// replace grid at index d with the one at index s
-extern void copy_grid( stack_index_t d, stack_index_t s )
+extern grid_hash_t compute_grid_hash( grid_cell_t (*cells)[ SUDOKU_N_COLS ] )
 {
-    memcpy( &cellArray[ d ], &cellArray[ s ],
-            sizeof(sudoku_cell_t) * SUDOKU_N_ROWS * SUDOKU_N_COLS );
-    rowArray[ d ] = rowArray[ s ];
-    colArray[ d ] = colArray[ s ];
+    const grid_cell_t *cell_array = &cells[0][0];
+    grid_hash_t hash = 0;
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; cell++ ) {
+        hash ^= get_map_hash( cell, get_cell_map( cell_array[cell] ) );
+    }
+    return hash;
 }
 
-extern void copy_fill_grid( stack_index_t csi, stack_index_t psi )
+extern grid_hash_t get_grid_hash( void )
 {
-    for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
-        for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            if ( 1 <= cellArray[psi][r][c].n_symbols ) {
-                     // don't touch cells with symbols
-                cellArray[csi][r][c] = cellArray[psi][r][c];
-            } else { // automatically populate for solving
-                cellArray[csi][r][c].n_symbols = SUDOKU_N_SYMBOLS;
-                cellArray[csi][r][c].symbol_map = SUDOKU_SYMBOL_MASK;
-                cellArray[csi][r][c].state = 0;
-            }
+    return *get_current_hash( );
+}
+
+extern grid_hash_t get_filled_grid_hash( void )
+{
+    const grid_cell_t *cell_array = &get_current_cells( )[0][0];
+    grid_hash_t hash = *get_current_hash( );
+    for ( int cell = 0; cell < SUDOKU_N_CELLS; cell++ ) {
+        if ( 0 == get_cell_map( cell_array[cell] ) ) {
+            hash ^= get_map_hash( cell, SUDOKU_SYMBOL_MASK );
         }
     }
-    rowArray[ csi ] = rowArray[ psi ];
-    colArray[ csi ] = colArray[ psi ];
+    return hash;
+}
+
+// all changes of cell symbols go through set_cell_map, which updates the index and hash
+static void set_cell_map( grid_cell_t *cell, int row, int col, int map )
+{
+    int previous = get_cell_map( *cell );
+    int previous_penciled = get_penciled_map( *cell );
+    *cell = (grid_cell_t)( ( *cell & GIVEN_CELL_FLAG ) | map );
+    toggle_locations( get_current_index( ), row, col, previous_penciled ^ get_penciled_map( *cell ) );
+    *get_current_hash( ) ^= get_map_hash( row * SUDOKU_N_COLS + col, previous ^ map );
+}
+
+extern void set_private_grid( private_grid_t *grid )
+{
+    if ( grid ) {
+        build_location_index( grid->cells, &grid->index );
+        grid->hash = compute_grid_hash( grid->cells );
+    }
+    private_grid = grid;
 }
 
 extern void get_selected_row_col( int *row, int *col )
 {
     SUDOKU_ASSERT( row );
     SUDOKU_ASSERT( col );
-    int csi = get_current_stack_index( );
-    *row = rowArray[ csi ];
-    *col = colArray[ csi ];
+    grid_state_t *state = &get_stacked_grid( )->state;
+    *row = state->row;
+    *col = state->col;
 }
 
 extern void select_row_col( int row, int col )
 {
-    int csi = get_current_stack_index( );
-    int cur_row = rowArray[ csi ];
-    if ( -1 != cur_row ) {
-        int cur_col = colArray[ csi ];
-        SUDOKU_ASSERT( -1 != cur_col );
-        cellArray[csi][cur_row][cur_col].state &= ~SUDOKU_SELECTED;
-    }
-
+    grid_state_t *state = &get_stacked_grid( )->state;
     if ( -1 != row ) {
         assert( -1 != col );
-        cellArray[csi][row][col].state |= SUDOKU_SELECTED;
         update_grid_errors( row, col );
     } else {
         reset_grid_errors( );
     }
 
-    rowArray[ csi ] = row;
-    colArray[ csi ] = col;
+    state->row = (int8_t)row;
+    state->col = (int8_t)col;
 }
 
-extern sudoku_cell_t * get_cell( int row, int col ) // exported to solve.c and hint.c
+extern grid_cell_t get_cell( int row, int col ) // exported to solve.c and hint.c
 {
-    int csi = get_current_stack_index( );
-    return &cellArray[csi][row][col];
+    grid_cell_t (*cells)[ SUDOKU_N_COLS ] = get_current_cells( );
+    return cells[row][col];
 }
 
-extern bool sudoku_get_cell_definition( int row, int col, sudoku_cell_t *cell )
+extern bool sudoku_get_cell_definition( sudoku_session_t *session,
+                                        int row, int col, sudoku_cell_t *cell )
 {
     assert( cell );
+    set_session( session );
     if ( 0 <= row && 9 >= row && 0 <= col && 9 >= col ) {
-        int csi = get_current_stack_index( );
-//        printf("sudoku_get_cell_definition: csi=%d\n", csi );
-        cell->state = cellArray[csi][row][col].state;
-        cell->n_symbols = cellArray[csi][row][col].n_symbols;
-        cell->symbol_map = cellArray[csi][row][col].symbol_map;
+        grid_cell_t gcell = get_current_cells( )[row][col];
+        int state = get_current_attributes( )[row][col];
+        if ( is_given_cell( gcell ) ) {
+            state |= SUDOKU_GIVEN;
+        } else {                    // selected whenever the grid selection is there,
+            int sel_row, sel_col;   // including in a grid just filled with candidates
+            get_selected_row_col( &sel_row, &sel_col );
+            if ( row == sel_row && col == sel_col ) state |= SUDOKU_SELECTED;
+        }
+        cell->state = (sudoku_cell_state_t)state;
+        cell->n_symbols = (uint8_t)get_cell_n_symbols( gcell );
+        cell->symbol_map = (uint16_t)get_cell_map( gcell );
         return true;
     }
     return false;
 }
 
-// return the number of bits (candidates or locations) in a map. Used in hint.c
-extern int get_n_bits_from_map( int map )
-{
-    int n_bits = 0;
-    for ( int i = 0; ; ++i ) {
-        if ( 0 == map ) break;
-        if ( map & 1 << i ) {
-            ++n_bits;
-            map &= ~ ( 1 << i );
-        }
-    }
-    return n_bits;
-}
-
-// return 1 bit (candidates or locations) at a time from a map. Used in hint.c & files.c
-extern int extract_bit_from_map( int *map )
-{
-    if ( 0 == *map ) return -1;
-
-    for ( int i = 0; ; ++i ) {
-        int mask = 1 << i;
-        if ( *map & mask ) {
-            *map &= ~mask;
-            return i;
-        }
-    }
-}
-
-// return the symbol number given a cell map (assuming n_symbols is 1)
-extern int get_number_from_map( unsigned short map )
-{
-    static char s_mapping[ ] = {                      // speedup a bit with a table
-    -1, 0, 1,-1, 2,-1,-1,-1, 3,-1,-1,-1,-1,-1,-1,-1,  // 0, 1:0, 2:1, 3, 4:2, 5..7, 8:3, 9..15
-     4,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 16:4,17..31
-     5,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 32:5, 33..47
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 48..63, 63
-     6,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 64:6, 65..79
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 80..95
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 96..111
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 112..127
-     7,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 128:7, 129..143
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 144..159
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 160..175
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 176..191
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 192..207
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 208..223
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 224..239
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,  // 244..255
-     8                                                // 256:8
-    };
-
-    if ( map > 256 ) return -1;
-    return s_mapping[ map ];
-}
-
 extern char sudoku_get_symbol( sudoku_cell_t *cell )
 {
     int val = get_number_from_map( cell->symbol_map );
@@ -170,13 +188,17 @@ extern char sudoku_get_symbol( sudoku_cell_t *cell )
     return ' ';
 }
 
+extern void clear_grid_attributes( void )
+{
+    memset( get_current_attributes( ), 0, sizeof(grid_attributes_t) );
+}
+
 extern void reset_grid_errors( void )
 {
-    int csi = get_current_stack_index( );
+    uint8_t (*attributes)[ SUDOKU_N_COLS ] = get_current_attributes( );
     for ( int r = 0; r < SUDOKU_N_ROWS; ++ r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++ c ) {
-            sudoku_cell_t *cell = &cellArray[csi][r][c];
-            cell->state &= ~SUDOKU_IN_ERROR;
+            attributes[r][c] &= (uint8_t)~SUDOKU_IN_ERROR;
         }
     }
 }
@@ -185,70 +207,37 @@ extern size_t update_grid_errors( int row, int col )
 {
     reset_grid_errors( );
 
-    int csi = get_current_stack_index( );
-    int mask = cellArray[csi][row][col].symbol_map;
+    grid_cell_t *cells = &get_current_cells( )[0][0];
+    uint8_t *attributes = &get_current_attributes( )[0][0];
+    const uint8_t *peers = cell_peers[ row * SUDOKU_N_COLS + col ];
+    int mask = get_cell_map( cells[ row * SUDOKU_N_COLS + col ] );
     int n_errors = 0;
 
-    for (int c = 0; c < SUDOKU_N_COLS; c ++ ) {
-        if ( ( 1 == cellArray[csi][row][c].n_symbols ) && ( col != c ) ) {
-            if ( mask & cellArray[csi][row][c].symbol_map ) {
-                cellArray[csi][row][c].state |= SUDOKU_IN_ERROR;
-                n_errors++;
-            }
-        }
-    }
-
-    for ( int r = 0; r < SUDOKU_N_ROWS; r ++ ) {
-        if ( ( 1 == cellArray[csi][r][col].n_symbols ) && ( row != r ) ) {
-            if ( mask & cellArray[csi][r][col].symbol_map ) {
-                cellArray[csi][r][col].state |= SUDOKU_IN_ERROR;
-                n_errors++;
-            }
-        }
-    }
-
-    int box_first_col = col - (col % 3); 
-    int box_first_row = row - (row % 3);
-
-    for ( int r = 0; r < SUDOKU_N_ROWS / 3; r++ ) {
-        for ( int c = 0; c < SUDOKU_N_COLS / 3; c++ ) {
-            if ( ( box_first_row + r != row ) && ( box_first_col + c != col ) ) {
-                if ( 1 == cellArray[csi][box_first_row + r][box_first_col + c].n_symbols ) {
-                    if ( mask & cellArray[csi][box_first_row + r][box_first_col + c].symbol_map ) {
-                        cellArray[csi][box_first_row + r][box_first_col + c].state |= SUDOKU_IN_ERROR;
-                        n_errors++;
-                    }
-                }
-            }
+    for ( int i = 0; i < SUDOKU_N_PEERS; ++i ) {
+        grid_cell_t cell = cells[ peers[i] ];
+        if ( ( 1 == get_cell_n_symbols( cell ) ) && ( mask & get_cell_map( cell ) ) ) {
+            attributes[ peers[i] ] |= SUDOKU_IN_ERROR;
+            n_errors++;
         }
     }
     return n_errors;
 }
 
-extern void check_cell_integrity( sudoku_cell_t *c )
-{
-    int n_symbols = get_n_bits_from_map( c->symbol_map );
-    if ( n_symbols == c->n_symbols ) return;
-
-    char *err = ( n_symbols < c->n_symbols ) ? "less" : "more";
-    printf( "%s symbols in cell map %d than indicated in n_symbols %d\n", err, n_symbols, c->n_symbols );
-    SUDOKU_ASSERT( 0 );
-}
-
 extern bool is_cell_given( int row, int col )
 {
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
-    int csi = get_current_stack_index( );
-    return cellArray[csi][row][col].state & SUDOKU_GIVEN;
+    return is_given_cell( get_cell( row, col ) );
 }
 
 extern void make_cells_given( void )  // exported to sudoku_commit_game in game.c
 {
-    int csi = get_current_stack_index( );
+    grid_cell_t (*cells)[ SUDOKU_N_COLS ] = get_current_cells( );
+    uint8_t (*attributes)[ SUDOKU_N_COLS ] = get_current_attributes( );
     for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
         for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            if ( 1 == cellArray[csi][r][c].n_symbols )  {
-                cellArray[csi][r][c].state = SUDOKU_GIVEN;
+            if ( 1 == get_cell_n_symbols( cells[r][c] ) )  {
+                cells[r][c] |= GIVEN_CELL_FLAG;
+                attributes[r][c] = 0;
             }
         }
     }
@@ -257,18 +246,19 @@ extern void make_cells_given( void )  // exported to sudoku_commit_game in game.
 extern bool is_cell_empty( int row, int col )
 {
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
-    sudoku_cell_t *cell = get_cell( row, col );
-    return 0 == cell->n_symbols;
+    return 0 == get_cell_map( get_cell( row, col ) );
 }
 
 extern void set_cell_symbol( int row, int col, int symbol, bool is_given )
 {
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( symbol >= 0 && symbol < 9 );
-    sudoku_cell_t *cell = get_cell( row, col );
-    cell->n_symbols = 1;
-    if ( is_given ) cell->state = SUDOKU_GIVEN;
-    cell->symbol_map = get_map_from_number( symbol );
+    grid_cell_t *cell = &get_current_cells( )[row][col];
+    if ( is_given ) {
+        *cell |= GIVEN_CELL_FLAG;
+        get_current_attributes( )[row][col] = 0;
+    }
+    set_cell_map( cell, row, col, get_map_from_number( symbol ) );
 }
 
 extern void add_cell_candidate( int row, int col, int symbol )           // exported to file.c
@@ -276,14 +266,12 @@ extern void add_cell_candidate( int row, int col, int symbol )           // expo
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( symbol >= 0 && symbol < 9 );
 
-    sudoku_cell_t *cell = get_cell( row, col );
-    SUDOKU_ASSERT( 0 == (SUDOKU_GIVEN & cell->state) );
-    if ( cell->symbol_map & get_map_from_number( symbol ) ) {
+    grid_cell_t *cell = &get_current_cells( )[row][col];
+    SUDOKU_ASSERT( ! is_given_cell( *cell ) );
+    if ( *cell & get_map_from_number( symbol ) ) {
         return; // value is already in the map
     }
-    cell->n_symbols++;
-    cell->symbol_map |= get_map_from_number( symbol );
-    check_cell_integrity( cell );
+    set_cell_map( cell, row, col, get_cell_map( *cell ) | get_map_from_number( symbol ) );
 }
 
 extern void toggle_cell_candidate( int row, int col, int symbol )
@@ -291,31 +279,28 @@ extern void toggle_cell_candidate( int row, int col, int symbol )
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( symbol >= 0 && symbol < 9 );
 
-    sudoku_cell_t *cell = get_cell( row, col );
+    grid_cell_t *cell = &get_current_cells( )[row][col];
     int mask = get_map_from_number( symbol );
+    int map = get_cell_map( *cell ) ^ mask;
 
-    if ( cell->symbol_map & mask ) {
-        --cell->n_symbols;
-        SUDOKU_TRACE( SUDOKU_INTERFACE_DEBUG, ( "Removing Symbol %d (0x%02x) remaining symbols %d\n",
-                                                symbol, cell->symbol_map ^ mask, cell->n_symbols ) );
-    } else { /* symbol was not set */
-        ++cell->n_symbols;
+    if ( map & mask ) {
         SUDOKU_TRACE( SUDOKU_INTERFACE_DEBUG, ( "Adding Symbol %d (0x%02x) total symbols %d\n",
-                                                symbol, cell->symbol_map ^ mask, cell->n_symbols ) );
+                                                symbol, map, get_n_bits_from_map( map ) ) );
+    } else { /* symbol was set */
+        SUDOKU_TRACE( SUDOKU_INTERFACE_DEBUG, ( "Removing Symbol %d (0x%02x) remaining symbols %d\n",
+                                                symbol, map, get_n_bits_from_map( map ) ) );
     }
-    cell->symbol_map ^= mask;
-    check_cell_integrity( cell );
+    set_cell_map( cell, row, col, map );
 }
 
 extern void set_cell_candidates( int row, int col, int n_candidates, int candidate_map )
 {
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( n_candidates > 0 && n_candidates <= SUDOKU_N_SYMBOLS );
+    SUDOKU_ASSERT( n_candidates == get_n_bits_from_map( candidate_map ) );
+    (void)n_candidates;
 
-    sudoku_cell_t *cell = get_cell( row, col );
-    cell->symbol_map = candidate_map;
-    cell->n_symbols = n_candidates;
-    check_cell_integrity( cell );
+    set_cell_map( &get_current_cells( )[row][col], row, col, candidate_map );
 }
 
 extern void remove_cell_candidates( int row, int col, int n_candidates, int candidate_map )
@@ -323,32 +308,29 @@ extern void remove_cell_candidates( int row, int col, int n_candidates, int cand
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( n_candidates > 0 && n_candidates <= SUDOKU_N_SYMBOLS );
 
-    sudoku_cell_t *cell = get_cell( row, col );
-    int n_in_common = get_n_bits_from_map( cell->symbol_map & candidate_map );
-    SUDOKU_ASSERT( n_candidates >= n_in_common );
+    grid_cell_t *cell = &get_current_cells( )[row][col];
+    SUDOKU_ASSERT( n_candidates >= get_n_bits_from_map( *cell & candidate_map ) );
+    (void)n_candidates;
 
-    cell->n_symbols -= n_in_common;
-    cell->symbol_map = cell->symbol_map & ~candidate_map;
-    check_cell_integrity( cell );
+    set_cell_map( cell, row, col, get_cell_map( *cell ) & ~candidate_map );
 }
 
 extern bool get_cell_type_n_map( int row, int col, uint8_t *nsp, int *mp ) // exported to file.c
 {
     SUDOKU_ASSERT( row >= 0 && row < 9 && col >= 0 && col < 9 );
     SUDOKU_ASSERT( nsp && mp );
-    sudoku_cell_t *cell = get_cell( row, col );
-    *nsp = cell->n_symbols;
-    *mp = cell->symbol_map;
-    return SUDOKU_IS_CELL_GIVEN( cell->state );
+    grid_cell_t cell = get_cell( row, col );
+    *nsp = (uint8_t)get_cell_n_symbols( cell );
+    *mp = get_cell_map( cell );
+    return is_given_cell( cell );
 }
 
 extern void erase_cell( int row, int col )  // exported to game_erase_cell in game.c
 {
-    sudoku_cell_t *cell = get_cell( row, col );
-    SUDOKU_ASSERT( ! SUDOKU_IS_CELL_GIVEN( cell->state ) );
-    cell->n_symbols = 0;
-    cell->symbol_map = 0;
-    cell->state &= SUDOKU_SELECTED;        // keep selection if any
+    grid_cell_t *cell = &get_current_cells( )[row][col];
+    SUDOKU_ASSERT( ! is_given_cell( *cell ) );
+    set_cell_map( cell, row, col, 0 );
+    get_current_attributes( )[row][col] = 0;
 }
 
 extern int count_single_symbol_cells( void )
@@ -356,8 +338,7 @@ extern int count_single_symbol_cells( void )
     int n = 0;
     for ( int c = 0; c < SUDOKU_N_COLS; c ++ ) {
         for ( int r = 0; r < SUDOKU_N_ROWS; r ++ ) {
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( 1 == cell->n_symbols ) ++n;
+            if ( 1 == get_cell_n_symbols( get_cell( r, c ) ) ) ++n;
         }
     }
     return n;
@@ -369,9 +350,9 @@ extern bool is_game_solved( void )
 
     for ( int c = 0; c < SUDOKU_N_COLS; c ++ ) {
         for ( int r = 0; r < SUDOKU_N_ROWS; r ++ ) {
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( 1 == cell->n_symbols ) {
-                int symbol = get_number_from_map( cell->symbol_map );
+            grid_cell_t cell = get_cell( r, c );
+            if ( 1 == get_cell_n_symbols( cell ) ) {
+                int symbol = get_number_from_map( get_cell_map( cell ) );
                 ++n_symbols[ symbol ];
             }
         }
@@ -391,8 +372,8 @@ extern int get_singles_matching_map_in_game( int symbol_map, cell_ref_t *singles
     int count = 0;
     for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            sudoku_cell_t * cell = get_cell( r, c );
-            if ( 1 == cell->n_symbols && ( symbol_map & cell->symbol_map ) ) {
+            grid_cell_t cell = get_cell( r, c );
+            if ( 1 == get_cell_n_symbols( cell ) && ( symbol_map & get_cell_map( cell ) ) ) {
                 singles[count].row = r;
                 singles[count].col = c;
                 ++count;
@@ -404,42 +385,17 @@ extern int get_singles_matching_map_in_game( int symbol_map, cell_ref_t *singles
 
 static int get_no_conflict_candidates( int row, int col, uint16_t *pmap )
 {
-    int csi = get_current_stack_index( ),
+    grid_cell_t *cells = &get_current_cells( )[0][0];
+    const uint8_t *peers = cell_peers[ row * SUDOKU_N_COLS + col ];
+    int
         n_symbols = SUDOKU_N_SYMBOLS;
     uint16_t map = SUDOKU_SYMBOL_MASK;
 
-    for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-        if ( ( 1 == cellArray[csi][row][c].n_symbols ) && ( col != c ) ) {
-            if ( map & cellArray[csi][row][c].symbol_map ) {
-                map &= ~ cellArray[csi][row][c].symbol_map;
-                --n_symbols;
-            }
-        }
-    }
-
-    for ( int r = 0; r < SUDOKU_N_ROWS; r ++ ) {
-        if ( ( 1 == cellArray[csi][r][col].n_symbols ) && ( row != r ) ) {
-            if ( map & cellArray[csi][r][col].symbol_map ) {
-                map &= ~ cellArray[csi][r][col].symbol_map;
-                --n_symbols;
-            }
-        }
-    }
-
-    int box_first_col = col - (col % 3); 
-    int box_first_row = row - (row % 3);
-
-    for ( int r = 0; r < SUDOKU_N_ROWS / 3; r++ ) {
-        for ( int c = 0; c < SUDOKU_N_COLS / 3; c++ ) {
-            if ( ( box_first_row + r != row ) && ( box_first_col + c != col ) ) {
-                sudoku_cell_t *cell = &cellArray[csi][box_first_row + r][box_first_col + c];
-                if ( 1 == cell->n_symbols ) {
-                    if ( map & cell->symbol_map ) {
-                        map &= ~ cell->symbol_map;
-                        --n_symbols;
-                    }
-                }
-            }
+    for ( int i = 0; i < SUDOKU_N_PEERS; ++i ) {
+        grid_cell_t cell = cells[ peers[i] ];
+        if ( ( 1 == get_cell_n_symbols( cell ) ) && ( map & get_cell_map( cell ) ) ) {
+            map &= ~ get_cell_map( cell );
+            --n_symbols;
         }
     }
 printf( "get_no_conflict_candidates: row %d col %d, map 0x%03x n_symbols %d\n", row, col, map, n_symbols );
@@ -447,142 +403,102 @@ printf( "get_no_conflict_candidates: row %d col %d, map 0x%03x n_symbols %d\n",
     return n_symbols;
 }
 
-typedef struct { int row, col, mask; } symbol_location_t;
-
-static int remove_symbol( symbol_location_t *queue, int *beyond, int row, int col, int mask )
-/* returns -1 if it is an invalid cell, 0 if the cell does not contain the symbol mask or is a given,
-   or 1 if it did and the new cell location has been added to the queue. */
-{
-    sudoku_cell_t *cell = get_cell( row, col );
-
-    if ( cell->n_symbols > 1 ) {
-        unsigned short map = cell->symbol_map;
-
-        if ( map & mask ) {
-            cell->symbol_map = (map & ~mask);
-            if ( 1 == --cell->n_symbols ) {         // enqueue new single
-                queue[*beyond].row = row;
-                queue[*beyond].col = col;
-                queue[*beyond].mask = cell->symbol_map;
-                ++ *beyond;
-            }
-            return 1;                               // indicate symbols has been removed
-        }
-
-    } else if ( cell->symbol_map == mask ) {
-        return -1;                                  // indicate an impossible case
-    }
-    return 0;                                       // symbol not in map, no effect
-}
-
 extern bool remove_grid_conflicts( void )
 /* it returns false if the grid is invalid or true if it is a valid grid.
-   If valid the grid has been cleaned up from any possible conflict */
+   If valid the grid has been cleaned up from any possible conflict, otherwise
+   it is left unchanged. */
 {
-    symbol_location_t queue[ SUDOKU_N_SYMBOLS * SUDOKU_N_SYMBOLS ];
-    int start = 0;
-
-    for ( int col = 0; col < SUDOKU_N_COLS; ++col ) {
-        for ( int row = 0; row < SUDOKU_N_ROWS; ++row ) {
-            sudoku_cell_t *cell = get_cell( row, col );
-            if ( 1 != cell->n_symbols ) continue;
+    grid_cell_t (*cells)[ SUDOKU_N_COLS ] = get_current_cells( );
+    uint16_t maps[ SUDOKU_N_CELLS ];
 
-            queue[start].row = row;
-            queue[start].col = col;
-            queue[start].mask = cell->symbol_map;
-            ++start;
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            maps[ r * SUDOKU_N_COLS + c ] = (uint16_t)get_cell_map( cells[r][c] );
         }
     }
-    int beyond = start;
-    start = 0;
-
-    while ( start < beyond ) {
-        int mask = queue[start].mask, row = queue[start].row, col = queue[start].col;
-        ++start;
-
-        for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) { // intersection of all other rows
-            if ( r == row ) continue;               // except itself, with the same column
-            if ( -1 == remove_symbol( queue, &beyond, r, col, mask ) ) return false;
-        }
+    if ( ! eliminate_candidates( maps ) ) return false;
 
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            if ( c == col ) continue;
-            if ( -1 == remove_symbol( queue, &beyond, row, c, mask ) ) return false;
-        }
-
-        int box_first_col = col - (col % 3); 
-        int box_first_row = row - (row % 3);
-        for ( int r = box_first_row; r < box_first_row + 3; ++r ) {
-            for ( int c = box_first_col; c < box_first_col + 3; ++c ) {
-                if ( ( r == row ) && ( c == col ) ) continue;
-                if ( -1 == remove_symbol( queue, &beyond, r, c, mask ) ) return false;
+            uint16_t map = maps[ r * SUDOKU_N_COLS + c ];
+            if ( map != get_cell_map( cells[r][c] ) ) {
+                set_cell_map( &cells[r][c], r, c, map );
             }
         }
-        assert( beyond <= SUDOKU_N_SYMBOLS * SUDOKU_N_SYMBOLS );
     }
     return true;
 }
 
 extern void fill_in_cell( int row, int col, bool no_conflict )
 {
-    sudoku_cell_t *scell = get_cell( row, col );
+    grid_cell_t *scell = &get_current_cells( )[row][col];
 
 #if 0
-    SUDOKU_ASSERT( ! SUDOKU_IS_CELL_GIVEN( scell->state ) );
+    SUDOKU_ASSERT( ! is_given_cell( *scell ) );
 #else
-    if ( SUDOKU_IS_CELL_GIVEN( scell->state ) ) return;
+    if ( is_given_cell( *scell ) ) return;
 #endif
 
     // do not touch cells with symbols
-    if ( 0 != scell->n_symbols ) return;
+    if ( 0 != get_cell_map( *scell ) ) return;
 
     if ( no_conflict ) { // remove conlicting pencils
-        scell->n_symbols = get_no_conflict_candidates( row, col, &scell->symbol_map );
+        uint16_t map;
+        get_no_conflict_candidates( row, col, &map );
+        set_cell_map( scell, row, col, map );
     } else {
-        scell->n_symbols = SUDOKU_N_SYMBOLS;
-        scell->symbol_map = SUDOKU_SYMBOL_MASK;
+        set_cell_map( scell, row, col, SUDOKU_SYMBOL_MASK );
         update_grid_errors( row, col );
     }
 }
 
 extern void set_cell_attributes( int row, int col, cell_attrb_t attrb )
 {
-    int csi = get_current_stack_index( );
+    uint8_t *attributes = &get_current_attributes( )[row][col];
     if ( HINT & attrb ) {
-        cellArray[csi][row][col].state |= SUDOKU_HINT;
+        *attributes |= SUDOKU_HINT;
     } else if ( WEAK_TRIGGER & attrb ) {
-        cellArray[csi][row][col].state |= SUDOKU_WEAK_TRIGGER;
+        *attributes |= SUDOKU_WEAK_TRIGGER;
     } else if ( REGULAR_TRIGGER & attrb ) {
-        cellArray[csi][row][col].state |= SUDOKU_TRIGGER;
+        *attributes |= SUDOKU_TRIGGER;
     } else if ( ALTERNATE_TRIGGER & attrb ) {
-        cellArray[csi][row][col].state |= SUDOKU_ALTERNATE_TRIGGER;
+        *attributes |= SUDOKU_ALTERNATE_TRIGGER;
     }
     if ( HEAD & attrb ) {
-        cellArray[csi][row][col].state |= SUDOKU_CHAIN_HEAD;
+        *attributes |= SUDOKU_CHAIN_HEAD;
     }
-    if ( (PENCIL & attrb) && (0 == cellArray[csi][row][col].n_symbols) ) {
-        cellArray[csi][row][col].n_symbols =
-            get_no_conflict_candidates( row, col, &cellArray[csi][row][col].symbol_map );
+    grid_cell_t *cell = &get_current_cells( )[row][col];
+    if ( (PENCIL & attrb) && (0 == get_cell_map( *cell )) ) {
+        uint16_t map;
+        get_no_conflict_candidates( row, col, &map );
+        set_cell_map( cell, row, col, map );
     }
 //printf( "game: set_cell_hint csi=%d row=%d, col=%d hint=%d => state=0x%04x\n",
-//        csi, row, col, hint, cellArray[csi][row][col].state );
+//        csi, row, col, hint, *attributes );
 }
 
 extern void reset_cell_attributes( void )
 {
-    int csi = get_current_stack_index( );
+    uint8_t (*attributes)[ SUDOKU_N_COLS ] = get_current_attributes( );
 
     for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            cellArray[csi][r][c].state &=
+            attributes[r][c] &= (uint8_t)(
                 ~SUDOKU_HINT & ~SUDOKU_CHAIN_HEAD &
-                ~SUDOKU_WEAK_TRIGGER & ~SUDOKU_TRIGGER & ~SUDOKU_ALTERNATE_TRIGGER;
+                ~SUDOKU_WEAK_TRIGGER & ~SUDOKU_TRIGGER & ~SUDOKU_ALTERNATE_TRIGGER );
         }
     }
     printf( "game: reset all cell attributes\n" );
 }
 
 // Debugging functions
+static char get_cell_symbol( grid_cell_t cell )
+{
+    int val = get_number_from_map( (unsigned short)get_cell_map( cell ) );
+    if ( -1 != val ) return '1' + val;
+    return ' ';
+}
+
 extern void print_grid( void )
 {
 #if SUDOKU_PRETTY_PRINT
@@ -597,11 +513,11 @@ extern void print_grid( void )
         printf( "  |" );
 #endif
         for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            sudoku_cell_t *ccell = get_cell( r, c );
+            grid_cell_t ccell = get_cell( r, c );
             unsigned char symbol;
-            if ( 1 == ccell->n_symbols ) {
-                symbol = sudoku_get_symbol( ccell );
-            } else if ( ccell->n_symbols > 1 ) {
+            if ( 1 == get_cell_n_symbols( ccell ) ) {
+                symbol = get_cell_symbol( ccell );
+            } else if ( get_cell_n_symbols( ccell ) > 1 ) {
                 symbol = '+';
             } else {
                 symbol = ' ';
@@ -640,18 +556,18 @@ extern void print_grid( void )
         printf( "%d|", r );
 
         for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            sudoku_cell_t *ccell = get_cell( r, c );
+            grid_cell_t ccell = get_cell( r, c );
             unsigned char symbol;
-            if ( 1 == ccell->n_symbols ) {
-                symbol = sudoku_get_symbol( ccell );
+            if ( 1 == get_cell_n_symbols( ccell ) ) {
+                symbol = get_cell_symbol( ccell );
             } else {
                 symbol = ' ';
             }
             if ( ( c == 2 ) || ( c == 5 ) || ( c == 8 ) ) {
 #if SUDOKU_SPECIAL_DEBUG
-                printf( "%c:%04x|", symbol, ccell->symbol_map );
+                printf( "%c:%04x|", symbol, get_cell_map( ccell ) );
             } else {
-                printf( "%c:%04x ", symbol,  ccell->symbol_map );
+                printf( "%c:%04x ", symbol,  get_cell_map( ccell ) );
 #else
                 printf( " %c |", symbol );
             } else {
@@ -669,21 +585,21 @@ extern void print_grid( void )
 #endif
 }
 
-static char *get_pencil_string( sudoku_cell_t *cell )
+static char *get_pencil_string( grid_cell_t cell )
 {
-    static char buffer[10];
+    static _Thread_local char buffer[10];
 
-    if ( 1 == cell->n_symbols ) {
+    if ( 1 == get_cell_n_symbols( cell ) ) {
         strcpy( buffer, "         " );
         buffer[2] = '<';
-        buffer[4] = sudoku_get_symbol( cell );
+        buffer[4] = get_cell_symbol( cell );
         buffer[6] = '>';
     } else {
         for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
-            if ( cell->symbol_map & (1 << i) ) {
+            if ( get_cell_map( cell ) & (1 << i) ) {
                 buffer[i] = '1' + i;
             } else {
-                if ( cell->n_symbols )
+                if ( get_cell_n_symbols( cell ) )
                     buffer[i] = ' ';
                 else
                     buffer[i] = '.';
@@ -705,7 +621,7 @@ extern void print_grid_pencils( void )
         printf( "%d|", r );
 
         for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-            sudoku_cell_t *cell = get_cell( r, c );
+            grid_cell_t cell = get_cell( r, c );
             char *s = get_pencil_string( cell );
             if ( ( c == 2 ) || ( c == 5 ) || ( c == 8 ) ) {
                 printf( "%s|", s );
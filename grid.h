@@ -4,6 +4,8 @@
 
 #include "sudoku.h"
 #include "debug.h"
+#include "bitops.h"
+#include "zobrist.h"
 
 /*
   Sudoku grid management: cell reference, selection, modification and conflict detection
@@ -36,8 +38,30 @@
 
 #define SUDOKU_N_BOXES 9
 
-extern int get_n_bits_from_map( int map );
-extern int extract_bit_from_map( int *map );
+/* A cell in a grid is packed in 16 bits: its symbol map, with 1 bit per symbol,
+   and a flag above the map if the cell is given. The number of symbols in a cell
+   is the number of bits in its map. The cell rendering attributes (selection,
+   errors, hints and triggers) are not part of the grid, so that they are not
+   saved in stack with the grid: they are kept for the current grid only, and
+   they are combined with the cell in sudoku_get_cell_definition. */
+typedef uint16_t grid_cell_t;
+
+#define GIVEN_CELL_FLAG         ( SUDOKU_SYMBOL_MASK + 1 )
+
+static inline int get_cell_map( grid_cell_t cell )
+{
+    return cell & SUDOKU_SYMBOL_MASK;
+}
+
+static inline int get_cell_n_symbols( grid_cell_t cell )
+{
+    return get_n_bits_from_map( cell & SUDOKU_SYMBOL_MASK );
+}
+
+static inline bool is_given_cell( grid_cell_t cell )
+{
+    return cell & GIVEN_CELL_FLAG;
+}
 
 extern void get_selected_row_col( int *row, int *col );
 extern void select_row_col( int row, int col );
@@ -55,11 +79,42 @@ extern void remove_cell_candidates( int row, int col, int n_candidates, int cand
 extern void erase_cell( int row, int col );
 extern bool get_cell_type_n_map( int row, int col, uint8_t *nsp, int *mp );
 
-extern sudoku_cell_t * get_cell( int row, int col );
-extern bool sudoku_get_cell_definition( int row, int col, sudoku_cell_t *cell );
-extern void check_cell_integrity( sudoku_cell_t *c );
+extern grid_cell_t get_cell( int row, int col );
+
+/* The location index gives, for each symbol, the cells where that symbol is a
+   penciled candidate (in cells with more than 1 symbol), as 9-bit masks per
+   row (1 bit per column), per column (1 bit per row) and per box (1 bit per
+   cell index in box). The 9 row masks of a symbol make its 81-bit position
+   bitboard. Each grid has its own index, kept up to date by all cell operations
+   below, so that cell symbols must not be modified directly through get_cell. */
+typedef struct {
+    uint16_t        rows[ SUDOKU_N_SYMBOLS ][ SUDOKU_N_ROWS ];
+    uint16_t        cols[ SUDOKU_N_SYMBOLS ][ SUDOKU_N_COLS ];
+    uint16_t        boxes[ SUDOKU_N_SYMBOLS ][ SUDOKU_N_BOXES ];
+} location_index_t;
+
+extern const location_index_t * get_location_index( void );
+extern void build_location_index( grid_cell_t (*cells)[ SUDOKU_N_COLS ], location_index_t *index );
+
+/* Each grid also has its own zobrist hash (see zobrist.h), kept up to date by all
+   cell operations, like the location index. get_grid_hash returns the hash of the
+   current grid, whereas compute_grid_hash computes it from scratch. */
+extern grid_hash_t get_grid_hash( void );
+// return the hash the current grid would have once filled for solving, with all
+// candidates in empty cells, as copy_fill_grid does
+extern grid_hash_t get_filled_grid_hash( void );
+extern grid_hash_t compute_grid_hash( grid_cell_t (*cells)[ SUDOKU_N_COLS ] );
+
+/* A private grid is a standalone grid, out of the game stack. Once set, it is
+   used by all cell operations in the calling thread, including get_cell, until
+   it is reset with NULL. Its cells must be filled before it is set. */
+typedef struct {
+    grid_cell_t         cells[ SUDOKU_N_ROWS ][ SUDOKU_N_COLS ];
+    location_index_t    index;
+    grid_hash_t         hash;
+} private_grid_t;
 
-extern int get_number_from_map( unsigned short map );
+extern void set_private_grid( private_grid_t *grid );
 
 static inline unsigned short get_map_from_number( int number )
 {
@@ -80,13 +135,20 @@ extern int get_singles_matching_map_in_game( int symbol_map, cell_ref_t *singles
 
 static inline bool is_single_ref( cell_ref_t *cr )
 {
-    sudoku_cell_t *cell = get_cell( cr->row, cr->col );
-    return 1 == cell->n_symbols;
+    return 1 == get_cell_n_symbols( get_cell( cr->row, cr->col ) );
 }
 
 extern bool remove_grid_conflicts( void );
 extern void fill_in_cell( int row, int col, bool no_conflict );
 
+/* Rendering attributes of the current game grid, as sudoku_cell_state_t flags
+   other than SUDOKU_GIVEN and SUDOKU_SELECTED, which are given by the grid. */
+typedef struct {
+    uint8_t             cells[ SUDOKU_N_ROWS ][ SUDOKU_N_COLS ];
+} grid_attributes_t;
+
+extern void clear_grid_attributes( void );
+
 extern void reset_grid_errors( void );
 extern size_t update_grid_errors( int row, int col );
 
@@ -90,8 +90,15 @@ typedef struct {
     char                    background_path[1+SUDOKU_DIR_PATH_LEN];
     char                    wname[1+SUDOKU_MAX_NAME_LEN];
 
+    sudoku_session_t        *session;
+
 } game_cntxt_t;
 
+static inline sudoku_session_t *session_of( const void *data )
+{
+    return ((game_cntxt_t *)data)->session;
+}
+
 static bool initialize_paths( game_cntxt_t *game_cx , char *command )
 {
     /* find sudoku directory from the command line */
@@ -247,7 +254,7 @@ static gboolean timed_game_fct( gpointer data )
     game_cntxt_t *cntxt = (game_cntxt_t *)data;
 
     sudoku_duration_t duration;
-    if ( cntxt->display_time_state && sudoku_how_long_playing( &duration ) ) {
+    if ( cntxt->display_time_state && sudoku_how_long_playing( cntxt->session, &duration ) ) {
         char info_buffer[64];
         sprintf( info_buffer, "time: %02d:%02d:%02d", duration.hours, duration.minutes, duration.seconds );
         gtk_label_set_text( GTK_LABEL(cntxt->info), (const char *)info_buffer );
@@ -260,7 +267,7 @@ static void manage_displaying_time( game_cntxt_t *cntxt )
 {
     if ( cntxt->display_time_state ) {
         sudoku_duration_t duration;
-        if ( sudoku_how_long_playing( &duration ) ) {
+        if ( sudoku_how_long_playing( cntxt->session, &duration ) ) {
             char info_buffer[64];
             sprintf( info_buffer, "time: %02d:%02d:%02d", duration.hours, duration.minutes, duration.seconds );
             gtk_label_set_text( GTK_LABEL(cntxt->info), (const char *)info_buffer );
@@ -563,7 +570,7 @@ static void draw_game( game_cntxt_t *game_cx, cairo_t *cr, double width, double
         double cy = y + ch * r;
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
             sudoku_cell_t cell;
-            sudoku_get_cell_definition( r, c, &cell );
+            sudoku_get_cell_definition( game_cx->session, r, c, &cell );
 //            printf( "Cell state 0x%03x\n", cell.state );
             double cx = x + (cw * c);
             if ( SUDOKU_IS_CELL_IN_ERROR( cell.state ) ) {
@@ -773,7 +780,7 @@ void button_event( GtkWidget *widget, GdkEventButton *event, gpointer data )
     double ex = (double)event->x, ey = (double)event->y;
     g_print ("Button pressed - x %g y %g\n", ex, ey );
 
-    if ( ! sudoku_is_selection_possible() ) return;
+    if ( ! sudoku_is_selection_possible( game_cx->session ) ) return;
 
     double x = 0.0, y = 0.0;
     double width = (double)gtk_widget_get_allocated_width( widget );    // draw area width
@@ -810,7 +817,7 @@ void button_event( GtkWidget *widget, GdkEventButton *event, gpointer data )
 
     if ( row != -1 && col != -1 ) {
         GRAPHIC_TRACE( ("cell found @row %d col %d\n", row, col) );
-        sudoku_set_selection( game_cx, row, col );
+        sudoku_set_selection( game_cx->session, row, col );
     }
 }
 
@@ -852,7 +859,7 @@ static gint key_event( GtkWidget *widget, GdkEventKey *event, gpointer data )
             GRAPHIC_TRACE( ( "Got key released on window, Ascii code 0x%x (%c)\n",
                     key_char, key_char ) );
             if ( key_char >= 0x31 && key_char <= 0x39 )
-                sudoku_enter_symbol( game_cntxt, key_char );
+                sudoku_enter_symbol( game_cntxt->session, key_char );
             return TRUE;
 
         case 0:
@@ -878,12 +885,12 @@ static gint key_event( GtkWidget *widget, GdkEventKey *event, gpointer data )
                 sudoku_key = SUDOKU_END_KEY; break;
 
             case GDK_KEY_Delete:
-                sudoku_erase_selection( (void *)game_cntxt );
+                sudoku_erase_selection( game_cntxt->session );
                 return TRUE;
             default:
                 sudoku_key = SUDOKU_NO_KEY; break;
             }
-            sudoku_move_selection( (void *)game_cntxt, sudoku_key );
+            sudoku_move_selection( game_cntxt->session, sudoku_key );
             return TRUE;
 
         /* English short cuts */
@@ -903,61 +910,61 @@ static gint key_event( GtkWidget *widget, GdkEventKey *event, gpointer data )
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Undo!\n");
 #endif
-            sudoku_undo( (void *)game_cntxt );
+            sudoku_undo( game_cntxt->session );
             return TRUE;
         case 'm': case 'M':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Mark!\n");
 #endif
-            sudoku_mark_state( (void *)game_cntxt );
+            sudoku_mark_state( game_cntxt->session );
             return TRUE;
         case 'b': case 'B':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Back!\n");
 #endif
-            sudoku_back_to_mark( (void *)game_cntxt );
+            sudoku_back_to_mark( game_cntxt->session );
             return TRUE;
         case 'r': case 'R':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Redo!\n");
 #endif
-            sudoku_redo( (void *)game_cntxt );
+            sudoku_redo( game_cntxt->session );
             return TRUE;
         case 't': case 'T':
 #if 1 //SUDOKU_GRAPHIC_DEBUG
             printf( "Execute 1 step\n");
 #endif
-            sudoku_step( (void *)game_cntxt );
+            sudoku_step( game_cntxt->session );
             return TRUE;
         case 'z': case 'Z':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Erase!\n");
 #endif
-            sudoku_erase_selection( (void *)game_cntxt );
+            sudoku_erase_selection( game_cntxt->session );
             return TRUE;
         case 'c': case 'C':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Check!\n");
 #endif
-            sudoku_check_from_current_position( (void *)game_cntxt );
+            sudoku_check_from_current_position( game_cntxt->session );
             return 0;
         case 'd': case 'D':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Do solve it!\n");
 #endif
-            sudoku_solve_from_current_position( (void *)game_cntxt );
+            sudoku_solve_from_current_position( game_cntxt->session );
             return TRUE;
         case 'h': case 'H':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Hint!\n");
 #endif
-            sudoku_hint( (void *)game_cntxt );
+            sudoku_hint( game_cntxt->session );
             return TRUE;
         case 'f': case 'F':
 #if SUDOKU_GRAPHIC_DEBUG
             printf("Fill!\n");
 #endif
-            sudoku_fill( (void *)game_cntxt, game_cntxt->remove_fill_state );
+            sudoku_fill( game_cntxt->session, game_cntxt->remove_fill_state );
             return TRUE;
     case 'o': case 'O':
 #if SUDOKU_GRAPHIC_DEBUG
@@ -1234,7 +1241,7 @@ void ui_success_dialog( const void *data, sudoku_duration_t *dhms )
         gtk_widget_destroy( restart );
         switch ( result ) {
         case GTK_RESPONSE_OK:
-            sudoku_random_game( data );
+            sudoku_random_game( session_of( data ) );
             manage_displaying_time( game_cntxt );
         default:
             break;
@@ -1248,9 +1255,10 @@ static int ok_to_stop_current_game( game_cntxt_t *game_cntxt )
 {
     game_state_t state = STOPPED;
 
-    if ( sudoku_is_game_on_going( ) || sudoku_is_entering_valid_game( ) ) {
+    if ( sudoku_is_game_on_going( game_cntxt->session ) ||
+         sudoku_is_entering_valid_game( game_cntxt->session ) ) {
         state = PLAYING;
-    } else if ( sudoku_is_entering_game_on_going( ) ) {
+    } else if ( sudoku_is_entering_game_on_going( game_cntxt->session ) ) {
         state = ENTERING;
     }
 
@@ -1274,7 +1282,7 @@ static void new_game( GtkWidget *wdg, gpointer data )
     GRAPHIC_TRACE( ("new_game - data %p\n", data) );
     game_cntxt_t *game_cntxt = (game_cntxt_t *)data;  
     if ( ok_to_stop_current_game( game_cntxt ) ) {
-        sudoku_random_game( (void *)data );
+        sudoku_random_game( session_of( data ) );
         manage_displaying_time( game_cntxt );
     }
 }
@@ -1295,7 +1303,7 @@ static void pick_game( GtkWidget *wdg, gpointer data )
                 input = get_widget_entry( pick );
                 assert( input );
                 GRAPHIC_TRACE( ("pick_game - returned ok game = %s\n", input) );
-                sudoku_pick_game( (void *)data, input );
+                sudoku_pick_game( session_of( data ), input );
                 manage_displaying_time( game_cntxt );
                 break;
             default:
@@ -1325,7 +1333,7 @@ static void open_game( GtkWidget *wdg, gpointer data )
         if ( dialog ) {
             if (gtk_dialog_run (GTK_DIALOG (dialog)) == GTK_RESPONSE_ACCEPT) {
                 char *filename = gtk_file_chooser_get_filename (GTK_FILE_CHOOSER (dialog));
-                sudoku_open_file( game_cntxt, filename );
+                sudoku_open_file( game_cntxt->session, filename );
                 was_a_game_saved_or_loaded = TRUE;
                 g_free (filename);
             }
@@ -1340,7 +1348,7 @@ static void enter_or_commit( GtkWidget *wdg, gpointer data )
     game_cntxt_t *game_cntxt = (game_cntxt_t *)data;
 
     GRAPHIC_TRACE( ("make game - data %p\n", data) );
-    if ( sudoku_is_entering_valid_game() ) {
+    if ( sudoku_is_entering_valid_game( game_cntxt->session ) ) {
         GtkWidget *commit = create_commit_dialog( GTK_WINDOW( game_cntxt->window ) );
         if ( commit ) {
             int result = gtk_dialog_run( GTK_DIALOG( commit ) );
@@ -1350,7 +1358,7 @@ static void enter_or_commit( GtkWidget *wdg, gpointer data )
                 input = get_widget_entry( commit );
                 assert( input );
                 GRAPHIC_TRACE( ("pick_game - returned ok game = %s\n", input) );
-                sudoku_commit_game( (void *)data, input );
+                sudoku_commit_game( session_of( data ), input );
                 break;
             default:
                 GRAPHIC_TRACE( ("commit_game - cancelled\n") );
@@ -1359,7 +1367,7 @@ static void enter_or_commit( GtkWidget *wdg, gpointer data )
             gtk_widget_destroy( commit );
         }
     } else {
-        sudoku_toggle_entering_new_game( (void *)data );
+        sudoku_toggle_entering_new_game( session_of( data ) );
     }
 }
 
@@ -1378,7 +1386,7 @@ static int do_save_game( game_cntxt_t *game_cntxt )
 
         if (gtk_dialog_run( GTK_DIALOG( dialog ) ) == GTK_RESPONSE_ACCEPT) {
             char *filename = gtk_file_chooser_get_filename( GTK_FILE_CHOOSER( dialog ) );
-            sudoku_save_file( game_cntxt, filename );
+            sudoku_save_file( game_cntxt->session, filename );
             was_a_game_saved_or_loaded = result = TRUE;
             g_free (filename);
         }
@@ -1437,9 +1445,10 @@ static int ok_to_quit( void *data )
     game_cntxt_t *game_cntxt = (game_cntxt_t *)data;
     game_state_t state = STOPPED;
 
-    if ( sudoku_is_game_on_going( ) || sudoku_is_entering_valid_game( ) ) {
+    if ( sudoku_is_game_on_going( game_cntxt->session ) ||
+         sudoku_is_entering_valid_game( game_cntxt->session ) ) {
         state = PLAYING;
-    } else if ( sudoku_is_entering_game_on_going( ) ) {
+    } else if ( sudoku_is_entering_game_on_going( game_cntxt->session ) ) {
         state = ENTERING;
     }
 
@@ -1485,49 +1494,49 @@ static void undo_move( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("undo_move - data %p\n", data ) );
-    sudoku_undo( (void *)data );
+    sudoku_undo( session_of( data ) );
 }
 
 static void redo_move( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("redo_move - data %p\n", data ) );
-    sudoku_redo( (void *)data );
+    sudoku_redo( session_of( data ) );
 }
 
 static void erase_move( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("erase_move - data %p\n", data ) );
-    sudoku_erase_selection( (void *)data );
+    sudoku_erase_selection( session_of( data ) );
 }
 
 static void mark_state( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("mark_state - data %p\n", data) );
-    sudoku_mark_state( (void *)data );
+    sudoku_mark_state( session_of( data ) );
 }
 
 static void back_to_state( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("back_to_state - data %p\n", data) );
-    sudoku_back_to_mark( (void *)data );
+    sudoku_back_to_mark( session_of( data ) );
 }
 
 static void check_move( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("check_move - data %p\n", data) );
-    sudoku_check_from_current_position( (void *)data );
+    sudoku_check_from_current_position( session_of( data ) );
 }
 
 static void hint_next( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("hint_next - data %p\n", data) );
-    sudoku_hint( (void *)data );
+    sudoku_hint( session_of( data ) );
 }
 
 static void fill_selection( GtkWidget *wdg, gpointer data )
@@ -1535,7 +1544,7 @@ static void fill_selection( GtkWidget *wdg, gpointer data )
     (void)wdg;
     GRAPHIC_TRACE( ("fill_selection - data %p\n", data) );
     game_cntxt_t *game_cntxt = ( game_cntxt_t *)data;
-    sudoku_fill( (void *)data, game_cntxt->remove_fill_state );
+    sudoku_fill( session_of( data ), game_cntxt->remove_fill_state );
 }
 
 static void fill_all( GtkWidget *wdg, gpointer data )
@@ -1543,14 +1552,14 @@ static void fill_all( GtkWidget *wdg, gpointer data )
     (void)wdg;
     GRAPHIC_TRACE( ("fill_all - data %p\n", data) );
     game_cntxt_t *game_cntxt = ( game_cntxt_t *)data;
-    sudoku_fill_all( (void *)data, game_cntxt->remove_fill_state );
+    sudoku_fill_all( session_of( data ), game_cntxt->remove_fill_state );
 }
 
 static void solve_game( GtkWidget *wdg, gpointer data )
 {
     (void)wdg;
     GRAPHIC_TRACE( ("solve_game - data %p\n", data) );
-    sudoku_solve_from_current_position( (void *)data );
+    sudoku_solve_from_current_position( session_of( data ) );
 }
 
 static void conflict_detect( GtkWidget *wdg, gpointer data )
@@ -1560,7 +1569,7 @@ static void conflict_detect( GtkWidget *wdg, gpointer data )
     gboolean state = gtk_check_menu_item_get_active( GTK_CHECK_MENU_ITEM( wdg ) );
     GRAPHIC_TRACE( ("conflict_detect - state %d data %p\n", state, data) );
 #endif
-    sudoku_toggle_conflict_detection( (void *)data );
+    sudoku_toggle_conflict_detection( session_of( data ) );
 }
 
 static void auto_check( GtkWidget *wdg, gpointer data )
@@ -1568,7 +1577,7 @@ static void auto_check( GtkWidget *wdg, gpointer data )
     (void)wdg;
     gboolean state = gtk_check_menu_item_get_active( GTK_CHECK_MENU_ITEM( wdg ) );
     printf("auto_check - state %d data %p\n", state, data );
-    sudoku_toggle_auto_checking( (void *)data );
+    sudoku_toggle_auto_checking( session_of( data ) );
 }
 
 static void display_time_if_needed( game_cntxt_t *cntxt, bool new_state )
@@ -1942,7 +1951,7 @@ static int demo_fct( gpointer demo_data )
     ++state->count;
     if ( state->count == state->next_hint ) {
         printf("Showing a hint\n");
-        sudoku_hint_type hint = sudoku_hint( state->instance );
+        sudoku_hint_type hint = sudoku_hint( session_of( state->instance ) );
 
         if ( NO_HINT == hint ) {
             if ( state->stop_after ) exit(0);   // if no hint, check stop after to exit
@@ -1951,7 +1960,7 @@ static int demo_fct( gpointer demo_data )
     }
     if ( state->count == state->next_step ) {
         printf("Executing 1 step\n");
-        sudoku_step( state->instance );
+        sudoku_step( session_of( state->instance ) );
         state->count = 0;   // reset the count
     }
     return 1;
@@ -1984,7 +1993,10 @@ int main( int argc, char *argv[] )
         .disable_menu_item = ui_disable_menu_item,
         .success_dialog = ui_success_dialog
     };
-    sudoku_game_init( instance, &ui_fcts );
+    game_cx->session = sudoku_session_new( instance, &ui_fcts );
+    if ( NULL == game_cx->session ) {
+        exit_error( "not enough memory for a new game" );
+    }
 
     args_t args;
     parse_sudoku_args( argc, argv, &args );
@@ -1992,14 +2004,14 @@ int main( int argc, char *argv[] )
 
     if ( NULL != args.file_name ) {
         printf("sudoku: starting game %s\n", args.file_name );
-        level = sudoku_open_file( instance, args.file_name );
+        level = sudoku_open_file( game_cx->session, args.file_name );
     } else if ( NULL != args.game_number ) {
         printf("sudoku: starting game %s\n", args.game_number );
-        level = sudoku_pick_game( instance, args.game_number );
+        level = sudoku_pick_game( game_cx->session, args.game_number );
     }
 
     if ( args.demo ) {
-        if ( 0 == level ) level = sudoku_random_game( instance );
+        if ( 0 == level ) level = sudoku_random_game( game_cx->session );
         demo_state_t dstate;
         dstate.instance = instance;
         dstate.stop_after = args.exit;
@@ -1,8 +1,10 @@
 /*
   Sudoku hint finder
 */
+#include <stdlib.h>
 #include <string.h>
 
+#include "session.h"
 #include "grid.h"
 #include "game.h"
 #include "hint.h"
@@ -13,6 +15,7 @@
 #include "fishes.h"
 #include "xywings.h"
 #include "chains.h"
+#include "rate.h"
 
 extern void get_other_boxes_in_same_box_row( int box, int *other_boxes )
 {
@@ -52,42 +55,16 @@ extern void get_other_boxes_in_same_box_col( int box, int *other_boxes )
     }
 }
 
-extern void get_cell_ref_in_set( locate_t by, int ref, int index, cell_ref_t *cr )
-// by is LOCATE_BY_ROW, LOCATE_BY_COL or LOCATE_BY_BOX.
-// ref is row, col or box id [0..8], index is col, row or cell index in box [0..8].
-{
-    assert( LOCATE_BY_ROW <= by && LOCATE_BY_BOX >= by );
-    assert( ref >= 0 && ref < SUDOKU_N_SYMBOLS );
-    assert( index >= 0 && index < SUDOKU_N_SYMBOLS );
-
-    switch( by ) {
-    case LOCATE_BY_ROW:
-        cr->row = ref;
-        cr->col = index;
-        break;
-    case LOCATE_BY_COL:
-        cr->row = index;
-        cr->col = ref;
-        break;
-    case LOCATE_BY_BOX:
-        cr->row = (3 * ( ref / 3 )) + (index / 3);
-        cr->col = (3 * ( ref % 3 )) + (index % 3);
-        break;
-    }
-}
-
 extern void get_box_row_intersection( int box, int row, cell_ref_t *intersection )
 // return 3 cells at the intersection of box and row if they do intersect
 {
-    int first_row = 3 * ( box / 3 );
-    int first_col = 3 * ( box % 3 );
+    int first_row, first_col;
+    get_box_first_row_col( box, &first_row, &first_col );
 
     if ( row >= first_row && row < first_row + 3 ) {
-        int index = 0;
-        for ( int c = first_col; c < first_col + 3; ++ c ) {
-            intersection[index].row = row;
-            intersection[index].col = c;
-            ++index;
+        int first_index = 3 * ( row - first_row );
+        for ( int index = 0; index < 3; ++ index ) {
+            get_cell_ref_in_set( LOCATE_BY_BOX, box, first_index + index, &intersection[index] );
         }
     }
 }
@@ -95,15 +72,13 @@ extern void get_box_row_intersection( int box, int row, cell_ref_t *intersection
 extern void get_box_col_intersection( int box, int col, cell_ref_t *intersection )
 // return 3 cells at the intersection of box and col if they do intersect
 {
-    int first_row = 3 * ( box / 3 );
-    int first_col = 3 * ( box % 3 );
+    int first_row, first_col;
+    get_box_first_row_col( box, &first_row, &first_col );
 
     if ( col >= first_col && col < first_col + 3 ) {
-        int index = 0;
-        for ( int r = first_row; r < first_row + 3; ++r ) {
-            intersection[index].row = r;
-            intersection[index].col = col;
-            ++index;
+        int first_index = col - first_col;
+        for ( int index = 0; index < 3; ++index ) {
+            get_cell_ref_in_set( LOCATE_BY_BOX, box, first_index + 3 * index, &intersection[index] );
         }
     }
 }
@@ -114,8 +89,8 @@ extern bool get_single_for_mask_in_set( locate_t by, int ref, int single_mask, c
     for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
         cell_ref_t cr;
         get_cell_ref_in_set( by, ref, i, &cr );
-        sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-        if ( single_mask == cell->symbol_map ) {
+        grid_cell_t cell = get_cell( cr.row, cr.col );
+        if ( single_mask == get_cell_map( cell ) ) {
             *single = cr;
             return true;
         }
@@ -126,13 +101,8 @@ extern bool get_single_for_mask_in_set( locate_t by, int ref, int single_mask, c
 extern cell_ref_t * get_single_in_box( cell_ref_t *singles, int n_singles, int box )
 // Get the single that fits in a box among a list of all singles in the game
 {
-    int box_first_row, box_first_col;
-    get_box_first_row_col( box, &box_first_row, &box_first_col );
-
     for ( int i = 0; i < n_singles; ++ i ) {
-        if ( singles[i].row >= box_first_row && singles[i].row < box_first_row + 3 &&
-             singles[i].col >= box_first_col && singles[i].col < box_first_col + 3 )
-            return &singles[i];
+        if ( is_cell_ref_in_box( box, &singles[i] ) ) return &singles[i];
     }
     return NULL;
 }
@@ -163,7 +133,7 @@ static void hint_desc_init( hint_desc_t *hdesc )
 
 static char *get_flavor( cell_attrb_t attrb )
 {
-    static char buffer[ 64 ];
+    static _Thread_local char buffer[ 64 ];
 
     char *flavor = NULL;
     int n = 0;
@@ -233,19 +203,19 @@ extern bool get_hint( hint_desc_t *hdp )
 {
     hint_desc_init( hdp );
     // 1. Search for a Naked Single - must be done first for removing single symbols from the pencils.
-    if ( look_for_naked_singles( hdp ) ) return true;
+    if ( look_for_naked_singles( hdp, NULL, NULL ) ) return true;
     // 2. Search for a Hidden Single
-    if ( look_for_hidden_singles( hdp ) ) return true;
+    if ( look_for_hidden_singles( hdp, NULL, NULL ) ) return true;
     // 3. Search for locked candidates
-    if ( check_locked_candidates( hdp ) ) return true;
+    if ( check_locked_candidates( hdp, NULL, NULL ) ) return true;
     // 4. Search for naked or hidden Subset
-    if ( check_subsets( hdp ) ) return true;
+    if ( check_subsets( hdp, NULL, NULL ) ) return true;
     // 5. Search for X-Wing, Swordfish and Jellyfish
-    if ( check_X_wings_Swordfish( hdp ) ) return true;
+    if ( check_X_wings_Swordfish( hdp, NULL, NULL ) ) return true;
     // 6. Search for XY-Wing
-    if ( search_for_xy_wing( hdp ) ) return true;
+    if ( search_for_xy_wing( hdp, NULL, NULL ) ) return true;
     // 7. Search for forbidding chains
-    if ( search_for_forbidding_chains( hdp ) ) return true;
+    if ( search_for_forbidding_chains( hdp, NULL, NULL ) ) return true;
 
     SUDOKU_ASSERT( NO_HINT == hdp->hint_type );
     SUDOKU_ASSERT( 0 == hdp->n_hints );
@@ -256,6 +226,55 @@ extern bool get_hint( hint_desc_t *hdp )
     return false;
 }
 
+extern bool report_hint( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+{
+    if ( NULL == fct ) return true;
+
+    bool more = fct( cntxt, hdesc );
+    hint_desc_init( hdesc );
+    return ! more;
+}
+
+typedef int (*search_fct_t)( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
+
+static const search_fct_t searches[ N_HINT_SEARCHES ] = {
+    look_for_naked_singles, look_for_hidden_singles, check_locked_candidates,
+    check_subsets, check_X_wings_Swordfish, search_for_xy_wing, search_for_forbidding_chains
+};
+
+extern int get_hints( hint_search_t search, hint_fct_t fct, void *cntxt )
+{
+    SUDOKU_ASSERT( search >= SEARCH_NAKED_SINGLES && search < N_HINT_SEARCHES );
+    SUDOKU_ASSERT( fct );
+    hint_desc_t hdesc;
+    hint_desc_init( &hdesc );
+    return searches[ search ]( &hdesc, fct, cntxt );
+}
+
+typedef struct {
+    hint_fct_t  fct;
+    void        *cntxt;
+    bool        stopped;
+} all_hints_t;
+
+static bool pass_hint( void *cntxt, hint_desc_t *hdesc )
+{
+    all_hints_t *all = cntxt;
+    all->stopped = ! all->fct( all->cntxt, hdesc );
+    return ! all->stopped;
+}
+
+extern int get_all_hints( hint_fct_t fct, void *cntxt )
+{
+    all_hints_t all = { fct, cntxt, false };
+    int n_hints = 0;
+    for ( hint_search_t search = SEARCH_NAKED_SINGLES; search < N_HINT_SEARCHES; ++search ) {
+        n_hints += get_hints( search, pass_hint, &all );
+        if ( all.stopped ) break;
+    }
+    return n_hints;
+}
+
 extern bool act_on_hint( hint_desc_t *hdesc )
 {
     SUDOKU_ASSERT( hdesc->n_hints );
@@ -279,6 +298,104 @@ extern bool act_on_hint( hint_desc_t *hdesc )
     return is_game_solved(); 
 }
 
+// return the cache entry for the game grid, emptied if it was for another grid
+static hint_cache_entry_t *get_hint_cache_entry( void )
+{
+    grid_hash_t hash = get_grid_hash( );
+    hint_cache_entry_t *entry = &get_session()->hints.entries[ hash & ( HINT_CACHE_SIZE - 1 ) ];
+    if ( entry->hash != hash ) {
+        entry->hash = hash;
+        entry->has_verdict = entry->has_hint = false;
+    }
+    return entry;
+}
+
+extern bool get_cached_solvability( bool *solvable )
+{
+    hint_cache_entry_t *entry = get_hint_cache_entry( );
+    if ( entry->has_verdict ) *solvable = entry->solvable;
+    return entry->has_verdict;
+}
+
+extern void set_cached_solvability( bool solvable )
+{
+    hint_cache_entry_t *entry = get_hint_cache_entry( );
+    entry->solvable = solvable;
+    entry->has_verdict = true;
+}
+
+extern void add_solve_path_step( solve_path_t *path, grid_hash_t hash, const hint_desc_t *hdesc )
+{
+    if ( path->n_steps == path->size ) {
+        int size = ( path->size ) ? 2 * path->size : 64;
+        path_step_t *steps = realloc( path->steps, size * sizeof(path_step_t) );
+        if ( NULL == steps ) return;        // the path is just shorter
+        path->steps = steps;
+        path->size = size;
+    }
+    path->steps[path->n_steps].hash = hash;
+    path->steps[path->n_steps].hdesc = *hdesc;
+    ++path->n_steps;
+}
+
+extern void clear_solve_path( solve_path_t *path )
+{
+    path->n_steps = path->next = 0;
+    path->to_make = false;
+}
+
+extern void set_solve_path_puzzle( solve_path_t *path, const sudoku_grid_t *puzzle )
+{
+    clear_solve_path( path );
+    path->puzzle = *puzzle;
+    path->to_make = true;
+}
+
+extern void free_solve_path( solve_path_t *path )
+{
+    free( path->steps );
+    memset( path, 0, sizeof(solve_path_t) );
+}
+
+// get the hint for the game grid from the solve path, if the grid is on the path
+static bool get_path_hint( hint_desc_t *hdesc )
+{
+    solve_path_t *path = &get_session()->path;
+    if ( path->to_make ) {
+        make_solve_path( &path->puzzle, path );     // clears to_make
+    }
+    if ( 0 == path->n_steps ) return false;
+
+    grid_hash_t hash = get_filled_grid_hash( );
+    int i = path->next;
+    if ( i >= path->n_steps || hash != path->steps[i].hash ) {  // not the expected step
+        for ( i = 0; i < path->n_steps && hash != path->steps[i].hash; ++i ) ;
+        if ( i == path->n_steps ) return false;
+    }
+    *hdesc = path->steps[i].hdesc;
+    path->next = i + 1;
+    return true;
+}
+
+// get the hint for the game grid from the cache or from the solve path, or search it
+// in a new grid for solving
+static bool get_game_hint( hint_desc_t *hdesc )
+{
+    hint_cache_entry_t *entry = get_hint_cache_entry( );
+    if ( ! entry->has_hint ) {
+        if ( get_path_hint( &entry->hdesc ) ) {
+            entry->hint = true;
+        } else {
+            void *game = save_current_game_for_solving();
+            entry->hint = get_hint( &entry->hdesc );
+            restore_saved_game( game );
+        }
+        entry->has_hint = true;
+    }
+    *hdesc = entry->hdesc;
+    return entry->hint;
+}
+
 static void show_hint_pencils( hint_desc_t *hdesc )
 {
     if ( ! hdesc->hint_pencil ) return;
@@ -289,10 +406,8 @@ static void show_hint_pencils( hint_desc_t *hdesc )
 
 extern int solve_step( void )
 {
-    void *game = save_current_game_for_solving();
     hint_desc_t hdesc;
-    bool hint = get_hint( &hdesc );
-    restore_saved_game( game );
+    bool hint = get_game_hint( &hdesc );
 
     if ( hint ) {
         game_new_grid( );           // make sure this step will be undoable
@@ -308,10 +423,8 @@ extern sudoku_hint_type find_hint( int *selection_row, int *selection_col )
 //printf("Before starting hints:\n");
 //print_grid_pencils();
 
-    void *game = save_current_game_for_solving();
     hint_desc_t hdesc;
-    bool hint = get_hint( &hdesc );
-    restore_saved_game( game );
+    bool hint = get_game_hint( &hdesc );
 
     if ( hint ) {
         *selection_row = hdesc.selection.row;
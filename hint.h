@@ -38,6 +38,71 @@ typedef struct {
 extern bool get_hint( hint_desc_t *hdp );
 extern bool act_on_hint( hint_desc_t *hdesc );
 
+/* Instead of stopping at its first hint, as in get_hint, a search can pass the
+   hints it finds to a hint function, which returns false to stop the search. The
+   hint function may act on the hint, the search going on in the changed grid.
+   Only the singles searches sweep the whole grid and give every single. Like
+   get_hint, the naked singles search removes the single symbols from their peers
+   while sweeping, giving the cells that become singles. The other searches give
+   at most the first hint found for each symbol, unit or pair they try, and not
+   every deduction of their technique. */
+typedef bool (*hint_fct_t)( void *cntxt, hint_desc_t *hdesc );
+
+typedef enum {                              // in get_hint order
+    SEARCH_NAKED_SINGLES, SEARCH_HIDDEN_SINGLES, SEARCH_LOCKED_CANDIDATES,
+    SEARCH_SUBSETS, SEARCH_FISHES, SEARCH_XY_WINGS, SEARCH_CHAINS, N_HINT_SEARCHES
+} hint_search_t;
+
+// return the number of hints passed to fct, for one technique or all of them
+extern int get_hints( hint_search_t search, hint_fct_t fct, void *cntxt );
+extern int get_all_hints( hint_fct_t fct, void *cntxt );
+
+/* Hints and solvability only depend on the candidates in the game grid, so that
+   they are kept by grid hash in a small cache in the session: asking again for a
+   hint, a step or a check on an unchanged grid does not search again. A new grid
+   hash just replaces the entry with the same low hash bits. */
+#define HINT_CACHE_SIZE 16                  // must be a power of 2
+
+typedef struct {
+    grid_hash_t         hash;
+    bool                has_verdict, solvable;
+    bool                has_hint, hint;
+    hint_desc_t         hdesc;
+} hint_cache_entry_t;
+
+typedef struct {
+    hint_cache_entry_t  entries[ HINT_CACHE_SIZE ];
+} hint_cache_t;
+
+// return true and set solvable if the solvability of the game grid is known
+extern bool get_cached_solvability( bool *solvable );
+extern void set_cached_solvability( bool solvable );
+
+/* The solve path of the game puzzle is the sequence of hints given by successive
+   steps, from the givens with all candidates up to the solution, each one with the
+   hash of the grid it was found in. As long as the game grid, filled for solving, is
+   on the path, its hint is read from the path instead of being searched. The path
+   is only made at the first hint that is not in the cache, so that starting a game
+   does not wait for it, and a game played without any hint never makes it. */
+typedef struct {
+    grid_hash_t         hash;               // grid in which the hint was found
+    hint_desc_t         hdesc;
+} path_step_t;
+
+typedef struct {
+    path_step_t         *steps;
+    int                 n_steps, size;
+    int                 next;               // step expected after the last one used
+    bool                to_make;            // the path of puzzle is not made yet
+    sudoku_grid_t       puzzle;
+} solve_path_t;
+
+// clear the path, which will be made from puzzle when needed
+extern void set_solve_path_puzzle( solve_path_t *path, const sudoku_grid_t *puzzle );
+extern void add_solve_path_step( solve_path_t *path, grid_hash_t hash, const hint_desc_t *hdesc );
+extern void clear_solve_path( solve_path_t *path );
+extern void free_solve_path( solve_path_t *path );
+
 // return 0 if could not step, 1 if it did a step, 2 if the game is solved
 extern int solve_step( void );
 extern sudoku_hint_type find_hint( int *row_hint, int *col_hint );
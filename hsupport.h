@@ -5,6 +5,9 @@
 */
 
 #include "hint.h"
+#include "units.h"
+
+// all cell addressing below is done through the constant tables in units.h
 
 static inline int get_surrounding_box( int row, int col )
 {
@@ -13,13 +16,14 @@ static inline int get_surrounding_box( int row, int col )
     3 [rows 3..5, cols 0..2] 4 [rows 3..5, cols 3..5] 5 [rows 3..5, cols 6..8]
     6 [rows 6..8, cols 0..2] 7 [rows 6..8, cols 3..5] 8 [rows 6..8, cols 6..8]
 */
-    return 3 * (row / 3) + (col / 3);
+    return cell_units[ row * SUDOKU_N_COLS + col ][ UNIT_BOX ];
 }
 
 static inline void get_box_first_row_col( int box, int *row, int *col )
 {
-    *row = 3 * ( box / 3 );
-    *col = 3 * ( box % 3 );
+    int first = get_unit_cell( UNIT_BOX, box, 0 );
+    *row = cell_units[ first ][ UNIT_ROW ];
+    *col = cell_units[ first ][ UNIT_COL ];
 }
 
 static inline bool are_cells_in_same_box( int r1, int c1, int r2, int c2 )
@@ -29,17 +33,17 @@ static inline bool are_cells_in_same_box( int r1, int c1, int r2, int c2 )
 
 static inline int get_cell_index_in_box( int row, int col )
 {
-    return 3 * ( row % 3 ) + ( col % 3 );
+    return cell_unit_indexes[ row * SUDOKU_N_COLS + col ][ UNIT_BOX ];
 }
 
 static inline int get_row_from_box_index( int box, int index )
 {
-    return 3 * ( box / 3 ) + ( index / 3 );
+    return cell_units[ get_unit_cell( UNIT_BOX, box, index ) ][ UNIT_ROW ];
 }
 
 static inline int get_col_from_box_index( int box, int index )
 {
-    return 3 * ( box % 3 ) + ( index % 3 );
+    return cell_units[ get_unit_cell( UNIT_BOX, box, index ) ][ UNIT_COL ];
 }
 
 extern void get_other_boxes_in_same_box_row( int box, int *other_boxes );
@@ -58,8 +62,33 @@ static inline bool is_cell_ref_in_box( int box, cell_ref_t *cr )
     return box == get_surrounding_box( cr->row, cr->col );
 }
 
-typedef enum { LOCATE_BY_ROW, LOCATE_BY_COL, LOCATE_BY_BOX } locate_t;
-extern void get_cell_ref_in_set( locate_t by, int ref, int index, cell_ref_t *cr );
+typedef enum { LOCATE_BY_ROW, LOCATE_BY_COL, LOCATE_BY_BOX } locate_t; // same order as unit_kind_t
+
+static inline void get_cell_ref_in_set( locate_t by, int ref, int index, cell_ref_t *cr )
+// by is LOCATE_BY_ROW, LOCATE_BY_COL or LOCATE_BY_BOX.
+// ref is row, col or box id [0..8], index is col, row or cell index in box [0..8].
+{
+    assert( LOCATE_BY_ROW <= by && LOCATE_BY_BOX >= by );
+    assert( ref >= 0 && ref < SUDOKU_N_SYMBOLS );
+    assert( index >= 0 && index < SUDOKU_N_SYMBOLS );
+
+    int cell = get_unit_cell( (unit_kind_t)by, ref, index );
+    cr->row = cell_units[ cell ][ UNIT_ROW ];
+    cr->col = cell_units[ cell ][ UNIT_COL ];
+}
+
+// Get the 9 location maps of a penciled symbol in rows, cols or boxes, from the
+// location index. Each map is indexed as in get_cell_ref_in_set.
+static inline const uint16_t * get_symbol_locations( locate_t by, int symbol )
+{
+    const location_index_t *index = get_location_index( );
+    switch( by ) {
+    case LOCATE_BY_ROW: return index->rows[symbol];
+    case LOCATE_BY_COL: return index->cols[symbol];
+    default:            break;
+    }
+    return index->boxes[symbol];
+}
 
 // get_single_for_mask_in_set looks for a single matching a given mask that fits in the given set
 extern bool get_single_for_mask_in_set( locate_t by, int ref, int single_mask, cell_ref_t *single );
@@ -73,6 +102,11 @@ extern cell_ref_t * get_single_in_row( cell_ref_t *singles, int n_singles, int r
 // Get the single that fits in a col among a list of all singles in the game
 extern cell_ref_t * get_single_in_col( cell_ref_t *singles, int n_singles, int col );
 
+// Pass a hint found by a search to fct (see get_hints) and clear hdesc for the next
+// one. Return true if the search must stop, always if fct is NULL, for get_hint:
+// in that case the hint is left in hdesc.
+extern bool report_hint( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
+
 typedef struct {
     int n_cols;             // for each row, the number of columns in which pencil is found
     int col_map;            // for each row, the candidate column map: 1 bit per column
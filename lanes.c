@@ -0,0 +1,193 @@
+/*
+  Sudoku lane parallel multi-puzzle solver
+*/
+#include <pthread.h>
+
+#include "lanes.h"
+
+/*
+   The candidate planes of N_LANES puzzles are interleaved: for each cell, one
+   vector holds the symbol map of that cell in every puzzle, one puzzle per lane.
+   Each propagation pass then runs on all puzzles at the same time:
+
+   1. naked singles: the symbols solved in each row, column and box are removed
+      from the other cells, a symbol solved twice in a unit is a contradiction,
+   2. hidden singles: a symbol that can go in only one cell of a unit is solved
+      there, a symbol that cannot go anywhere in a unit is a contradiction.
+
+   Per-lane masks keep track of contradicted puzzles (no solution). Passes are
+   repeated as long as one live puzzle changes. A live puzzle with all its cells
+   solved has a unique solution, since propagation only makes forced deductions.
+   Other puzzles need branching, which diverges between lanes: they are finished
+   individually by the scalar solver, starting from the cells solved so far.
+
+   Vectors use the compiler vector extensions, so that the same code compiles to
+   AVX2 on processors that support it or SSE2 otherwise. The version is selected
+   once at run time, as for eliminate_candidates in elim.c.
+*/
+
+typedef int16_t lanes_t __attribute__((vector_size(2 * N_LANES)));
+
+
+#define N_UNITS     (SUDOKU_N_ROWS + SUDOKU_N_COLS + SUDOKU_N_BOXES)
+
+static inline int get_unit_cell( int unit, int i )
+// units 0-8 are rows, 9-17 columns and 18-26 boxes
+{
+    if ( unit < SUDOKU_N_ROWS ) return unit * SUDOKU_N_COLS + i;
+    unit -= SUDOKU_N_ROWS;
+    if ( unit < SUDOKU_N_COLS ) return i * SUDOKU_N_COLS + unit;
+    unit -= SUDOKU_N_COLS;
+    return ((unit / 3) * 3 + i / 3) * SUDOKU_N_COLS + (unit % 3) * 3 + i % 3;
+}
+
+/* Vectors are not passed to or returned from functions, since the vector ABI
+   differs between the AVX2 and the default versions: helpers are macros. */
+
+// -1 in lanes where _m has 0 or 1 bit, 0 elsewhere
+#define SINGLES( _m )   ((lanes_t)( ( (_m) & ((_m) - 1) ) == 0 ))
+
+static inline __attribute__((always_inline)) uint32_t propagate( lanes_t *cells )
+// return the mask of lanes in contradiction, inlined in each version below
+{
+    const lanes_t all_symbols = (lanes_t){ 0 } + SUDOKU_SYMBOL_MASK;
+    lanes_t contradicted = { 0 };
+
+    while ( true ) {
+        lanes_t changed = { 0 }, placed[N_UNITS];
+
+        lanes_t duplicates = { 0 };             // 1. naked singles
+        for ( int u = 0; u < N_UNITS; ++u ) {
+            lanes_t once = { 0 }, twice = { 0 };
+            for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+                lanes_t m = cells[get_unit_cell( u, i )];
+                lanes_t solved = m & SINGLES( m );
+                twice |= once & solved;
+                once |= solved;
+            }
+            duplicates |= twice;
+            placed[u] = once;
+        }
+        contradicted |= (lanes_t)( duplicates != 0 );
+
+        for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+            int r = i / SUDOKU_N_COLS, c = i % SUDOKU_N_COLS, b = (r / 3) * 3 + c / 3;
+            lanes_t m = cells[i];
+            lanes_t removed = ~SINGLES( m ) &
+                              ( placed[r] | placed[SUDOKU_N_ROWS + c] |
+                                placed[SUDOKU_N_ROWS + SUDOKU_N_COLS + b] );
+            changed |= m & removed;
+            m &= ~removed;
+            contradicted |= (lanes_t)( m == 0 );
+            cells[i] = m;
+        }
+
+        for ( int u = 0; u < N_UNITS; ++u ) {   // 2. hidden singles
+            lanes_t once = { 0 }, twice = { 0 }, solved = { 0 };
+            for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+                lanes_t m = cells[get_unit_cell( u, i )];
+                lanes_t single = SINGLES( m );
+                solved |= m & single;
+                m &= ~single;
+                twice |= once & m;
+                once |= m;
+            }
+            contradicted |= (lanes_t)( ( once | solved ) != all_symbols );
+
+            lanes_t hidden = once & ~twice & ~solved;
+            for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+                int cell = get_unit_cell( u, i );
+                lanes_t m = cells[cell];
+                lanes_t h = m & hidden & ~SINGLES( m );
+                contradicted |= (lanes_t)( ( h & (h - 1) ) != 0 );   // 2 symbols for 1 cell
+                lanes_t set = (lanes_t)( h != 0 );
+                changed |= set;
+                cells[cell] = ( h & set ) | ( m & ~set );
+            }
+        }
+        changed &= ~contradicted;
+        bool live_change = false;
+        for ( int l = 0; l < N_LANES; ++l ) {
+            if ( changed[l] ) live_change = true;
+        }
+        if ( ! live_change ) {
+            uint32_t mask = 0;
+            for ( int l = 0; l < N_LANES; ++l ) {
+                if ( contradicted[l] ) mask |= 1u << l;
+            }
+            return mask;
+        }
+    }
+}
+
+static uint32_t propagate_default( lanes_t *cells )
+{
+    return propagate( cells );
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static __attribute__((target("avx2"))) uint32_t propagate_avx2( lanes_t *cells )
+{
+    return propagate( cells );
+}
+#endif
+
+static uint32_t (*propagate_fct)( lanes_t *cells );
+static pthread_once_t propagate_once = PTHREAD_ONCE_INIT;
+
+static void select_propagate_fct( void )
+{
+    propagate_fct = propagate_default;
+#if defined(__x86_64__) || defined(__i386__)
+    if ( __builtin_cpu_supports( "avx2" ) ) propagate_fct = propagate_avx2;
+#endif
+}
+
+extern void lanes_solve( sudoku_solver_t *solver, const sudoku_grid_t *puzzles, int n_puzzles,
+                         sudoku_grid_t *solutions, uint8_t *n_solutions )
+{
+    lanes_t cells[SUDOKU_N_CELLS];
+    bool invalid[N_LANES] = { false };
+
+    for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+        for ( int l = 0; l < N_LANES; ++l ) {
+            int symbol = ( l < n_puzzles ) ? puzzles[l].cells[i] : SUDOKU_EMPTY_CELL;
+            if ( SUDOKU_EMPTY_CELL == symbol ) {
+                cells[i][l] = SUDOKU_SYMBOL_MASK;
+            } else if ( symbol >= 1 && symbol <= SUDOKU_N_SYMBOLS ) {
+                cells[i][l] = (int16_t)(1 << (symbol - 1));
+            } else {
+                cells[i][l] = SUDOKU_SYMBOL_MASK;
+                invalid[l] = true;
+            }
+        }
+    }
+    pthread_once( &propagate_once, select_propagate_fct );
+    uint32_t contradicted = propagate_fct( cells );
+
+    for ( int l = 0; l < n_puzzles; ++l ) {
+        if ( invalid[l] || ( contradicted & (1u << l) ) ) {
+            n_solutions[l] = 0;
+            continue;
+        }
+
+        sudoku_grid_t grid;                     // cells solved by propagation
+        bool complete = true;
+        for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+            int map = cells[i][l];
+            if ( map & (map - 1) ) {
+                grid.cells[i] = SUDOKU_EMPTY_CELL;
+                complete = false;
+            } else {
+                grid.cells[i] = (int8_t)(1 + __builtin_ctz( map ));
+            }
+        }
+        if ( complete ) {
+            n_solutions[l] = 1;
+            if ( solutions ) solutions[l] = grid;
+        } else {                                // needs branching, lane diverges
+            sudoku_grid_t *solution = ( solutions ) ? &solutions[l] : NULL;
+            n_solutions[l] = (uint8_t)sudoku_solver_solve( solver, &grid, 2, solution );
+        }
+    }
+}
@@ -0,0 +1,22 @@
+/*
+  sudoku lanes.h
+
+  Suduku game: lane parallel multi-puzzle solver declarations
+*/
+
+#ifndef __LANES_H__
+#define __LANES_H__
+
+#include "sudoku.h"
+
+#define N_LANES     16      // puzzles solved at once, one per 16-bit vector lane
+
+/* Solve n_puzzles puzzles (up to N_LANES) at once. Singles are propagated in
+   lock-step for all puzzles, each one in its own vector lane. Puzzles that cannot
+   be completed by propagation alone are then finished one at a time with solver.
+   For each puzzle, n_solutions receives 0, 1 or 2 (more than one solution) and, if
+   solutions is not NULL, the solution is stored in the corresponding grid. */
+extern void lanes_solve( sudoku_solver_t *solver, const sudoku_grid_t *puzzles, int n_puzzles,
+                         sudoku_grid_t *solutions, uint8_t *n_solutions );
+
+#endif /* __LANES_H__ */
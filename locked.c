@@ -84,18 +84,12 @@ static void get_locations_in_horizontal_boxes_with_pencil( int first_row, int pe
 // crloc is an array of 3 candidate_row_location_t structures, giving the
 // columns where the penciled symbol is present in each horizontal box [0..2]
 {
+    const uint16_t *maps = get_symbol_locations( LOCATE_BY_ROW, get_number_from_map( pencil_map ) );
     for ( int r = 0; r < 3; ++r ) {     // 3 consecutive rows
         for ( int b = 0; b < 3; ++b ) { // 3 horizontal boxes intersecting each row
-            crloc[r].candidates[b].n_cols = 0;
-            crloc[r].candidates[b].col_map = 0;
-        }
-
-        for ( int c = 0; c < 9; ++c ) {
-            sudoku_cell_t * cell = get_cell( r + first_row, c );
-            if ( 1 < cell->n_symbols && ( pencil_map & cell->symbol_map ) ) {
-                ++crloc[r].candidates[c/3].n_cols;
-                crloc[r].candidates[c/3].col_map |= 1 << c; // actual column id
-            }
+            int col_map = maps[r + first_row] & ( 7 << (3 * b) ); // actual column ids
+            crloc[r].candidates[b].n_cols = get_n_bits_from_map( col_map );
+            crloc[r].candidates[b].col_map = col_map;
         }
     }
 }
@@ -109,18 +103,12 @@ static void get_locations_in_vertical_boxes_with_pencil( int first_col, int penc
 // ccloc is an array of 3 candidate_box_col_location_t structures, giving the
 // rows where the penciled symbol is present in each vertical box [0..2]
 {
+    const uint16_t *maps = get_symbol_locations( LOCATE_BY_COL, get_number_from_map( pencil_map ) );
     for ( int c = 0; c < 3; ++c ) {     // 3 consecutive columns
         for ( int b = 0; b < 3; ++b ) { // 3 vertical boxes intersecting each column
-            ccloc[c].candidates[b].n_rows = 0;
-            ccloc[c].candidates[b].row_map = 0;
-        }
-
-        for ( int r = 0; r < 9; ++r ) {
-            sudoku_cell_t * cell = get_cell( r, c + first_col );
-            if ( 1 < cell->n_symbols && ( pencil_map & cell->symbol_map ) ) {
-                ++ccloc[c].candidates[r/3].n_rows;
-                ccloc[c].candidates[r/3].row_map |= 1 << r; // actual row id
-            }
+            int row_map = maps[c + first_col] & ( 7 << (3 * b) ); // actual row ids
+            ccloc[c].candidates[b].n_rows = get_n_bits_from_map( row_map );
+            ccloc[c].candidates[b].row_map = row_map;
         }
     }
 }
@@ -140,8 +128,8 @@ static void fill_in_box_triggers( int first_row, int first_col,
                     }
                 }
                 if ( skip ) continue;
-                sudoku_cell_t * cell = get_cell( singles[i].row, c );
-                if ( 1 == cell->n_symbols ) continue;
+                grid_cell_t cell = get_cell( singles[i].row, c );
+                if ( 1 == get_cell_n_symbols( cell ) ) continue;
 
                 hdesc->triggers[n_triggers] = singles[i];
                 hdesc->flavors[n_triggers] = REGULAR_TRIGGER;
@@ -158,8 +146,8 @@ static void fill_in_box_triggers( int first_row, int first_col,
                     }
                 }
                 if ( skip ) continue;
-                sudoku_cell_t * cell = get_cell( r, singles[i].col );
-                if ( 1 == cell->n_symbols ) continue;
+                grid_cell_t cell = get_cell( r, singles[i].col );
+                if ( 1 == get_cell_n_symbols( cell ) ) continue;
 
                 hdesc->triggers[n_triggers] = singles[i];
                 hdesc->flavors[n_triggers] = REGULAR_TRIGGER;
@@ -194,11 +182,12 @@ static void fill_in_box_row_triggers( int box, int row, cell_ref_t *singles, int
     for( int i = 0; i < 3; ++i ) {                  // second phase, triggers outside each box
         if ( ! required_in_box[i] ) continue;
 
-        int box_first_col = 3 * ( boxes[i] % 3 );
+        int box_first_row, box_first_col;
+        get_box_first_row_col( boxes[i], &box_first_row, &box_first_col );
         for ( int c = box_first_col; c < box_first_col + 3; ++ c ) {
 
-            sudoku_cell_t * cell = get_cell( row, c );
-            if ( 1 == cell->n_symbols ) continue;   // single, no need for trigger
+            grid_cell_t cell = get_cell( row, c );
+            if ( 1 == get_cell_n_symbols( cell ) ) continue;   // single, no need for trigger
 
             cell_ref_t *single = get_single_in_col( singles, n_singles, c );
             if ( single ) {
@@ -260,8 +249,8 @@ static int fill_same_box_locked_row_hints( int box_row, int locked_row, int box,
                 hdesc->hints[n_hints].col = hint_col;
 
                 // check if it might be a new single
-                sudoku_cell_t * cell = get_cell( box_row + r, hint_col );
-                if ( 2 == cell->n_symbols ) {
+                grid_cell_t cell = get_cell( box_row + r, hint_col );
+                if ( 2 == get_cell_n_symbols( cell ) ) {
                     ++n_singles;
                     if ( -1 == hdesc->selection.row ) {
                         hdesc->selection.row = box_row + r;
@@ -296,8 +285,8 @@ static int fill_other_boxes_locked_row_hints( int box_row, int locked_row, int b
                 hdesc->hints[n_hints].col = hint_col;
 
                 // check if it might become a new single
-                sudoku_cell_t * cell = get_cell( box_row + locked_row, hint_col );
-                if ( 2 == cell->n_symbols ) {
+                grid_cell_t cell = get_cell( box_row + locked_row, hint_col );
+                if ( 2 == get_cell_n_symbols( cell ) ) {
                     ++n_singles;
                     if ( -1 == hdesc->selection.row ) {
                         hdesc->selection.row = box_row + locked_row;
@@ -401,11 +390,12 @@ static void fill_in_box_col_triggers( int box, int col, cell_ref_t *singles, int
     for( int i = 0; i < 3; ++i ) {
         if ( ! required_in_box[i] ) continue;
 
-        int box_first_row = 3 * ( boxes[i] / 3 );
+        int box_first_row, box_first_col;
+        get_box_first_row_col( boxes[i], &box_first_row, &box_first_col );
         for ( int r = box_first_row; r < box_first_row + 3; ++ r ) {
 
-            sudoku_cell_t * cell = get_cell( r, col );
-            if ( 1 == cell->n_symbols ) continue;
+            grid_cell_t cell = get_cell( r, col );
+            if ( 1 == get_cell_n_symbols( cell ) ) continue;
 
             cell_ref_t *single = get_single_in_row( singles, n_singles, r );
             if ( single ) {
@@ -467,8 +457,8 @@ static int fill_same_box_locked_col_hints( int box_col, int locked_col, int box,
                 hdesc->hints[n_hints].col = box_col + c;
 
                 // check if it might be a new single
-                sudoku_cell_t * cell = get_cell( hint_row, box_col + c );
-                if ( 2 == cell->n_symbols ) {
+                grid_cell_t cell = get_cell( hint_row, box_col + c );
+                if ( 2 == get_cell_n_symbols( cell ) ) {
                     ++n_singles;
                     if ( -1 == hdesc->selection.row ) {
                         hdesc->selection.row = hint_row;
@@ -503,8 +493,8 @@ static int fill_other_boxes_locked_col_hints( int box_col, int locked_col, int b
                 hdesc->hints[n_hints].col = box_col + locked_col;
 
                 // check if it might become a new single
-                sudoku_cell_t * cell = get_cell( hint_row, box_col + locked_col );
-                if ( 2 == cell->n_symbols ) {
+                grid_cell_t cell = get_cell( hint_row, box_col + locked_col );
+                if ( 2 == get_cell_n_symbols( cell ) ) {
                     ++n_singles;
                     if ( -1 == hdesc->selection.row ) {
                         hdesc->selection.row = hint_row;
@@ -578,10 +568,12 @@ static int get_locked_candidates_for_box_cols( int box_col, int symbol_mask,
     return -1;
 }
 
-extern bool check_locked_candidates( hint_desc_t *hdesc )
-/* return false if no locked candidate or if those candidates are already absent in other cells,
-          true if locked candidates allowing to eliminate those candidates in other cells. */
+extern int check_locked_candidates( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+/* return 0 if no locked candidate or if those candidates are already absent in other cells,
+          or the number of locked candidates allowing to eliminate those candidates in other
+          cells, at most one for each symbol in each box row and box col (see get_hints). */
 {
+    int n_hints = 0;
     for ( int symbol = 0; symbol < SUDOKU_N_SYMBOLS; ++symbol ) {
         int symbol_mask = get_map_from_number( symbol );
         cell_ref_t singles[9];
@@ -590,13 +582,18 @@ extern bool check_locked_candidates( hint_desc_t *hdesc )
         for ( int i = 0; i < 3; ++i ) {
             int in_rows = get_locked_candidates_for_box_rows( 3 * i, symbol_mask,
                                                               singles, n_singles, hdesc );
-            if ( in_rows >= 0 ) return true;
+            if ( in_rows >= 0 ) {
+                ++n_hints;
+                if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+            }
 
             int in_cols = get_locked_candidates_for_box_cols( 3 * i, symbol_mask,
                                                               singles, n_singles, hdesc );
-            if ( in_cols >= 0 ) return true;
+            if ( in_cols >= 0 ) {
+                ++n_hints;
+                if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+            }
         }
     }
-    return false;
+    return n_hints;
 }
-
@@ -1,4 +1,4 @@
 
 #include "hint.h"
 
-extern bool check_locked_candidates( hint_desc_t *hdesc );
+extern int check_locked_candidates( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
@@ -0,0 +1,21 @@
+/*
+  Sudoku game bank generator
+
+  Usage: mkbank [path]
+  It writes all games from SUDOKU_MIN_GAME_NUMBER to SUDOKU_MAX_GAME_NUMBER in
+  the bank file path, by default SUDOKU_BANK_PATH.
+*/
+#include <stdio.h>
+
+#include "bank.h"
+
+int main( int argc, char **argv )
+{
+    const char *path = ( argc > 1 ) ? argv[1] : SUDOKU_BANK_PATH;
+
+    if ( ! write_bank( path, SUDOKU_MIN_GAME_NUMBER, SUDOKU_MAX_GAME_NUMBER ) ) {
+        fprintf( stderr, "mkbank: unable to write %s\n", path );
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+  Sudoku work-stealing thread pool
+*/
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "pool.h"
+
+/* Each worker owns a range of items [next, end), protected by its own lock.
+   The owner consumes items from next, a thief takes items from end. */
+typedef struct {
+    pthread_mutex_t lock;
+    size_t          next, end;
+} pool_range_t;
+
+typedef struct {
+    pool_range_t    *ranges;
+    int             n_workers;
+    pool_task_fct_t task;
+    void            *cntxt;
+} pool_t;
+
+typedef struct {
+    pool_t          *pool;
+    int             worker;
+} pool_worker_t;
+
+extern int get_pool_default_n_workers( void )
+{
+    long n_cores = sysconf( _SC_NPROCESSORS_ONLN );
+    return ( n_cores > 0 ) ? (int)n_cores : 1;
+}
+
+static bool get_next_item( pool_range_t *range, size_t *item )
+{
+    bool available = false;
+    pthread_mutex_lock( &range->lock );
+    if ( range->next < range->end ) {
+        *item = range->next++;
+        available = true;
+    }
+    pthread_mutex_unlock( &range->lock );
+    return available;
+}
+
+static bool steal_items( pool_t *pool, int thief )
+// find the victim with the most remaining items and move the back half to the thief
+{
+    while ( true ) {
+        int victim = -1;
+        size_t most = 0;
+        for ( int w = 0; w < pool->n_workers; ++w ) {   // checked again when stealing
+            if ( w == thief ) continue;
+            pthread_mutex_lock( &pool->ranges[w].lock );
+            size_t remaining = pool->ranges[w].end - pool->ranges[w].next;
+            pthread_mutex_unlock( &pool->ranges[w].lock );
+            if ( remaining > most ) {
+                most = remaining;
+                victim = w;
+            }
+        }
+        if ( -1 == victim ) return false;               // nothing left anywhere
+
+        size_t beg = 0, end = 0;
+        pool_range_t *range = &pool->ranges[victim];
+        pthread_mutex_lock( &range->lock );
+        if ( range->next < range->end ) {
+            size_t half = ( 1 + range->end - range->next ) / 2;
+            end = range->end;
+            beg = range->end -= half;
+        }
+        pthread_mutex_unlock( &range->lock );
+
+        if ( beg < end ) {
+            range = &pool->ranges[thief];
+            pthread_mutex_lock( &range->lock );
+            range->next = beg;
+            range->end = end;
+            pthread_mutex_unlock( &range->lock );
+            return true;
+        }                                               // else victim emptied meanwhile, retry
+    }
+}
+
+static void *run_worker( void *arg )
+{
+    pool_worker_t *worker = arg;
+    pool_t *pool = worker->pool;
+    pool_range_t *range = &pool->ranges[worker->worker];
+
+    while ( true ) {
+        size_t item;
+        if ( get_next_item( range, &item ) ) {
+            pool->task( pool->cntxt, worker->worker, item );
+        } else if ( ! steal_items( pool, worker->worker ) ) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+extern bool pool_run( int n_workers, size_t n_items, pool_task_fct_t task, void *cntxt )
+{
+    if ( n_workers < 1 ) n_workers = 1;
+    if ( (size_t)n_workers > n_items ) n_workers = ( n_items ) ? (int)n_items : 1;
+
+    pool_t pool = { NULL, n_workers, task, cntxt };
+    pool.ranges = malloc( n_workers * sizeof(pool_range_t) );
+    pool_worker_t *workers = malloc( n_workers * sizeof(pool_worker_t) );
+    pthread_t *threads = malloc( n_workers * sizeof(pthread_t) );
+    if ( NULL == pool.ranges || NULL == workers || NULL == threads ) {
+        free( pool.ranges );
+        free( workers );
+        free( threads );
+        return false;
+    }
+
+    size_t beg = 0;
+    for ( int w = 0; w < n_workers; ++w ) {     // equal contiguous ranges to start with
+        size_t end = ( n_items * (w + 1) ) / n_workers;
+        pthread_mutex_init( &pool.ranges[w].lock, NULL );
+        pool.ranges[w].next = beg;
+        pool.ranges[w].end = end;
+        workers[w].pool = &pool;
+        workers[w].worker = w;
+        beg = end;
+    }
+
+    int n_started = 1;                          // the caller's thread is worker 0
+    for ( ; n_started < n_workers; ++n_started ) {
+        if ( 0 != pthread_create( &threads[n_started], NULL,
+                                  run_worker, &workers[n_started] ) ) break;
+    }                                           // missing workers get robbed by others
+    run_worker( &workers[0] );
+
+    for ( int w = 1; w < n_started; ++w ) {
+        pthread_join( threads[w], NULL );
+    }
+    for ( int w = 0; w < n_workers; ++w ) {
+        pthread_mutex_destroy( &pool.ranges[w].lock );
+    }
+    free( pool.ranges );
+    free( workers );
+    free( threads );
+    return true;
+}
@@ -0,0 +1,32 @@
+/*
+  sudoku pool.h
+
+  Suduku game: work-stealing thread pool declarations
+*/
+
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+   A pool runs a task on each of n_items items, spread over n_workers
+   threads (the caller's thread being worker 0). Items are initially
+   split in equal contiguous ranges, one per worker. A worker takes its
+   items one at a time from the front of its own range, and when its
+   range is empty it steals the back half of the largest remaining range.
+
+   The task is given the worker number (0 to n_workers-1), so that it can
+   use per-worker data allocated once by the caller, and the item index.
+*/
+typedef void (*pool_task_fct_t)( void *cntxt, int worker, size_t item );
+
+/* return the default number of workers, that is the number of online cores */
+extern int get_pool_default_n_workers( void );
+
+/* run the task on all items and return when all are done. It returns false
+   if the pool could not be created, in which case no task was run. */
+extern bool pool_run( int n_workers, size_t n_items, pool_task_fct_t task, void *cntxt );
+
+#endif /* __POOL_H__ */
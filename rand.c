@@ -2,25 +2,40 @@
   Sudoku game - random number interface
 */
 
-#include <stdlib.h>
 #include "rand.h"
 
-extern void set_random_seed ( unsigned int seed )
+#define PCG_MULTIPLIER  6364136223846793005ULL
+#define PCG_INCREMENT   1442695040888963407ULL
+
+static uint32_t get_next_random( random_state_t *random )
 {
-    srand( seed );
+    uint64_t old = random->state;
+    random->state = old * PCG_MULTIPLIER + random->inc;
+
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
 }
 
-extern int random_value ( int min_val, int max_val )
+extern void set_random_state_seed ( random_state_t *random, uint64_t seed )
 {
-    if ( min_val == max_val ) return min_val;
+    random->state = 0;
+    random->inc = PCG_INCREMENT;
+    get_next_random( random );
+    random->state += seed;
+    get_next_random( random );
+}
 
-    int modulo = (1+max_val-min_val);
-    int limit = RAND_MAX/modulo;
-    limit *= modulo;
+extern int random_state_value ( random_state_t *random, int min_val, int max_val )
+{
+    if ( min_val == max_val ) return min_val;
 
-    int randomv;
+    uint32_t modulo = (uint32_t)(1+max_val-min_val);
+    uint32_t limit = -modulo % modulo;      // 2^32 % modulo: reject the first
+                                            // values to avoid any bias
+    uint32_t randomv;
     do {
-        randomv = rand();
-    } while( randomv > limit );
-    return min_val + (randomv % modulo);
+        randomv = get_next_random( random );
+    } while( randomv < limit );
+    return min_val + (int)(randomv % modulo);
 }
@@ -7,9 +7,21 @@
 #ifndef __RAND_H__
 #define __RAND_H__
 
-extern void set_random_seed ( unsigned int seed );
+#include <stdint.h>
 
-/* return a pseudo-random number min_val through max_val, both included */
-extern int random_value ( int min_val, int max_val );
+/* The random generator is a PCG32 (permuted congruential generator), which gives
+   the same sequence for the same seed on any platform. Its state is small and
+   private to each user: each game session has its own state, and each thread
+   generating puzzles has its own one. */
+typedef struct {
+    uint64_t    state, inc;
+} random_state_t;
+
+/* set the state with a seed, for a new sequence of random numbers */
+extern void set_random_state_seed ( random_state_t *random, uint64_t seed );
+
+/* return a pseudo-random number min_val through max_val, both included,
+   drawing from the random state, which is updated. */
+extern int random_state_value ( random_state_t *random, int min_val, int max_val );
 
 #endif /* __RAND_H__ */
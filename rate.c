@@ -0,0 +1,201 @@
+/*
+  Sudoku puzzle rating
+*/
+#include <stdio.h>
+
+#include "grid.h"
+#include "hint.h"
+#include "rate.h"
+
+/*
+    A puzzle is rated by solving it with the same hints as a player would get,
+    the simplest first, and by counting how many hints of each type are needed.
+    This is done on a grid private to the calling thread, so that the game stack
+    is not touched and puzzles can be rated in any number of threads at once.
+*/
+
+extern void print_hint_stats( const sudoku_hint_stats_t *hstats )
+{
+    printf( "#Level determination:\n" );
+    printf( "  naked singles: %d\n", hstats->n_naked_singles );
+    printf( "  hidden singles: %d\n", hstats->n_hidden_singles );
+    printf( "  locked candidates: %d\n", hstats->n_locked_candidates );
+    printf( "  naked subsets: %d\n", hstats->n_naked_subsets );
+    printf( "  hidden subsets: %d\n", hstats->n_hidden_subsets );
+    printf( "  X-wings, fishes: %d\n", hstats->n_fishes );
+    printf( "  XY-wings: %d\n", hstats->n_xy_wings );
+    printf( "  chains: %d\n", hstats->n_chains );
+    printf( "  score: %d\n", hstats->score );
+}
+
+/* hint weights for the score, in order of hint difficulty */
+#define NAKED_SINGLE_WEIGHT         1
+#define HIDDEN_SINGLE_WEIGHT        2
+#define LOCKED_CANDIDATE_WEIGHT     4
+#define NAKED_SUBSET_WEIGHT         6
+#define HIDDEN_SUBSET_WEIGHT        8
+#define FISH_WEIGHT                 12
+#define XY_WING_WEIGHT              14
+#define CHAIN_WEIGHT                18
+#define NOT_SOLVED_WEIGHT           20
+
+#define MAX_STEP_SCORE              99
+
+static int get_score( const sudoku_hint_stats_t *hstats, bool solved )
+{
+    // from the hardest to the simplest hint type
+    static const int weights[] = {
+        CHAIN_WEIGHT, XY_WING_WEIGHT, FISH_WEIGHT, HIDDEN_SUBSET_WEIGHT,
+        NAKED_SUBSET_WEIGHT, LOCKED_CANDIDATE_WEIGHT, HIDDEN_SINGLE_WEIGHT, NAKED_SINGLE_WEIGHT
+    };
+    const int counts[] = {
+        hstats->n_chains, hstats->n_xy_wings, hstats->n_fishes, hstats->n_hidden_subsets,
+        hstats->n_naked_subsets, hstats->n_locked_candidates, hstats->n_hidden_singles,
+        hstats->n_naked_singles
+    };
+
+    int hardest = ( solved ) ? 0 : NOT_SOLVED_WEIGHT, steps = 0;
+    for ( size_t i = 0; i < sizeof(weights) / sizeof(weights[0]); ++i ) {
+        if ( counts[i] && 0 == hardest ) hardest = weights[i];
+        steps += counts[i] * weights[i];
+    }
+    steps /= 4;
+    int score = 100 * hardest + ( ( steps > MAX_STEP_SCORE ) ? MAX_STEP_SCORE : steps );
+    return ( score ) ? score : 1;       // a puzzle with all cells given: 0 means unknown
+}
+
+static sudoku_level_t assess_hint_stats( const sudoku_hint_stats_t *hstats )
+{
+    if ( hstats->n_chains || hstats->n_fishes || hstats->n_xy_wings ) return DIFFICULT;
+
+    if ( hstats->n_hidden_subsets ) return MODERATE;
+
+    if ( hstats->n_naked_subsets || hstats->n_locked_candidates ) return SIMPLE;
+
+    return EASY;
+}
+
+static int fill_private_grid( private_grid_t *grid, const sudoku_grid_t *puzzle )
+// set givens, and all candidates in other cells, as game_new_filled_grid does.
+// Return the number of cells that are not given.
+{
+    int n_empty = 0;
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            int symbol = puzzle->cells[r * SUDOKU_N_COLS + c];
+            if ( SUDOKU_EMPTY_CELL == symbol ) {
+                grid->cells[r][c] = SUDOKU_SYMBOL_MASK;
+                ++n_empty;
+            } else {
+                grid->cells[r][c] = GIVEN_CELL_FLAG | get_map_from_number( symbol - 1 );
+            }
+        }
+    }
+    return n_empty;
+}
+
+typedef struct {
+    sudoku_hint_stats_t hstats;
+    bool                solved;
+} rating_t;
+
+static bool rate_hint( void *cntxt, hint_desc_t *hdesc )
+{
+    rating_t *rating = cntxt;
+    sudoku_hint_stats_t *hstats = &rating->hstats;
+    switch( hdesc->hint_type ) {
+    case NO_HINT: case NO_SOLUTION:
+        SUDOKU_ASSERT( 0 );
+    case NAKED_SINGLE:
+        ++hstats->n_naked_singles;
+        break;
+    case HIDDEN_SINGLE:
+        ++hstats->n_hidden_singles;
+        break;
+    case LOCKED_CANDIDATE:
+        ++hstats->n_locked_candidates;
+        break;
+    case NAKED_SUBSET:
+        ++hstats->n_naked_subsets;
+        break;
+    case HIDDEN_SUBSET:
+        ++hstats->n_hidden_subsets;
+        break;
+    case XWING: case SWORDFISH: case JELLYFISH:
+        ++hstats->n_fishes;
+        break;
+    case XY_WING:
+        ++hstats->n_xy_wings;
+        break;
+    case CHAIN:
+        ++hstats->n_chains;
+        break;
+    }
+    rating->solved = act_on_hint( hdesc );
+    // naked singles are all taken in one sweep, other hints one at a time
+    return ! rating->solved && NAKED_SINGLE == hdesc->hint_type;
+}
+
+/*
+    Each round takes the hints of the simplest technique that gives some, as
+    get_hint would, but all the naked singles of a sweep at once, instead of
+    starting again from the first naked single after each one. This does not
+    change the rating: whatever the order naked singles are taken in, the same
+    cells become singles, and the grid left for the other techniques is the same.
+    Other hints are still taken one at a time, since a hidden single, for example,
+    may turn the next one into a naked single, which would change the score.
+*/
+extern sudoku_level_t sudoku_rate_puzzle( const sudoku_grid_t *puzzle,
+                                          sudoku_hint_stats_t *stats )
+{
+    private_grid_t grid;
+    int n_empty = fill_private_grid( &grid, puzzle );
+    set_private_grid( &grid );
+
+    rating_t rating = { { 0 }, 0 == n_empty };  // all cells given: no hint needed
+    sudoku_level_t level = DIFFICULT;           // if stopped without hint
+    while ( ! rating.solved ) {
+        hint_search_t search = SEARCH_NAKED_SINGLES;
+        while ( search < N_HINT_SEARCHES && 0 == get_hints( search, rate_hint, &rating ) ) {
+            ++search;
+        }
+        if ( N_HINT_SEARCHES == search ) break;
+    }
+    if ( rating.solved ) {
+        level = assess_hint_stats( &rating.hstats );
+    }
+    rating.hstats.score = get_score( &rating.hstats, rating.solved );
+
+    set_private_grid( NULL );
+    if ( stats ) *stats = rating.hstats;
+    return level;
+}
+
+/*
+    The hints of a solve path cannot be taken from rating: get_hint removes some
+    candidates on its own while searching, which is fine for rating, but a player
+    stepping through the game only gets the hint applied, since hints are searched
+    in a copy of the game grid (see solve_step). The path is made in the same way,
+    so that its grids are those the player goes through.
+*/
+extern void make_solve_path( const sudoku_grid_t *puzzle, solve_path_t *path )
+{
+    private_grid_t grid, copy;
+    fill_private_grid( &grid, puzzle );
+    clear_solve_path( path );
+
+    // each step removes at least 1 candidate
+    for ( int n = 0; n < SUDOKU_N_CELLS * SUDOKU_N_SYMBOLS; ++n ) {
+        copy = grid;
+        set_private_grid( &copy );
+        hint_desc_t hdesc;
+        bool hint = get_hint( &hdesc );
+
+        set_private_grid( &grid );
+        if ( ! hint ) break;
+
+        add_solve_path_step( path, grid.hash, &hdesc );
+        if ( act_on_hint( &hdesc ) ) break;
+    }
+    set_private_grid( NULL );
+}
@@ -0,0 +1,20 @@
+/*
+  sudoku rate.h
+
+  Suduku game: puzzle rating declarations
+*/
+
+#ifndef __RATE_H__
+#define __RATE_H__
+
+#include "sudoku.h"
+#include "hint.h"
+
+/* print the number of hints of each type that were needed to solve a puzzle */
+extern void print_hint_stats( const sudoku_hint_stats_t *hstats );
+
+/* make the solve path of a puzzle (see hint.h), from its givens with all candidates.
+   It does not use the game grid and it can be called from any thread. */
+extern void make_solve_path( const sudoku_grid_t *puzzle, solve_path_t *path );
+
+#endif /* __RATE_H__ */
@@ -0,0 +1,57 @@
+/*
+  sudoku session.h
+
+  Suduku game: game session related declarations
+*/
+
+#ifndef __SESSION_H__
+#define __SESSION_H__
+
+#include "sudoku.h"
+#include "rand.h"
+#include "stack.h"
+#include "grdstk.h"
+#include "game.h"
+#include "hint.h"
+
+/* A session holds all the state of a game in progress, so that one process can
+   run as many games as needed, each one with its own session. Each module keeps
+   its own part of the state in the session, and reaches it through get_session.
+
+   The session is not passed down to every internal function: each public
+   function taking a session makes it the current session of the calling thread,
+   which is then used by all internal functions until the next public call. As a
+   consequence, different sessions can be used at the same time in different
+   threads, but a session must not be used by two threads at the same time. */
+struct sudoku_session {
+    const void          *cntxt;         // given back to all ui functions
+    sudoku_ui_table_t   ui_fcts;
+    int                 state;          // interface state (sudoku.c)
+    bool                enter_game_valid, show_conflict, auto_check;
+
+    game_state_t        game;           // bookmarks, redo, level and time (game.c)
+    stack_state_t       stack;          // undo/redo stack pointers (stack.c)
+    grid_stack_t        grids;          // grids in stack (grdstk.c)
+    grid_attributes_t   attributes;     // current grid rendering, not in stack (grid.c)
+    hint_cache_t        hints;          // hints and solvability by grid hash (hint.c)
+    solve_path_t        path;           // steps from givens to solution (hint.c, rate.c)
+
+    sudoku_solver_t     *solver;        // game solver, allocated on first use (solve.c)
+    random_state_t      random;         // random game choice
+};
+
+extern _Thread_local sudoku_session_t *current_session;
+
+static inline sudoku_session_t *get_session( void )
+{
+    SUDOKU_ASSERT( current_session );
+    return current_session;
+}
+
+static inline void set_session( sudoku_session_t *session )
+{
+    SUDOKU_ASSERT( session );
+    current_session = session;
+}
+
+#endif /* __SESSION_H__ */
@@ -12,65 +12,13 @@
 
 static int remove_symbol( int row, int col, int remove_mask )
 {
-    sudoku_cell_t *cell = get_cell( row, col );
+    grid_cell_t cell = get_cell( row, col );
 
-    if ( cell->symbol_map & remove_mask ) {
-        SUDOKU_ASSERT ( cell->n_symbols > 1 );                  // in theory 0 or 1 is not possible
-        cell->symbol_map &= ~remove_mask;                       // remove single symbol mask
-        if ( 1 == --cell->n_symbols ) return cell->symbol_map;  // found a new naked single
-    }
-    return 0;
-}
-
-static int check_box_of( int row, int col, int remove_mask, 
-			              int *row_hint, int *col_hint )
-{
-    int first_row = row - (row % 3);
-    int first_col = col - (col % 3);
-
-    for ( int r = first_row; r < first_row + 3; ++r ) {
-        for ( int c = first_col; c < first_col + 3; ++c ) {
-            if ( r == row && c == col ) continue;   // don't check itself
-
-            int single_mask = remove_symbol( r, c, remove_mask );
-            if ( single_mask ) {
-                *row_hint = r;
-                *col_hint = c; 
-                return single_mask;
-            }
-        }
-    }
-    return 0;
-}
-
-static int check_row_of( int row, int col, int remove_mask, int *col_hint )
-{
-    int first_col = col - (col % 3); // assuming box has been or will be processed for the same mask
-
-    for ( int c = 0; c < SUDOKU_N_COLS; c++ ) {
-        if ( c >= first_col && c < first_col + 3 ) continue;
-
-        int single_mask = remove_symbol( row, c, remove_mask );
-        if ( single_mask ) {
-            *col_hint = c;
-            return single_mask;
-        }
-    }
-    return 0;
-}
-
-static int check_col_of( int row, int col, int remove_mask, int *row_hint )
-{
-    int first_row = row - (row % 3); // assuming box has been or will be processed for the same mask
-
-    for ( int r = 0; r < SUDOKU_N_ROWS; r++ ) {
-        if ( r >= first_row && r < first_row + 3 ) continue;
-
-        int single_mask = remove_symbol( r, col, remove_mask );
-        if ( single_mask ) {
-            *row_hint = r;
-            return single_mask;
-        }
+    if ( get_cell_map( cell ) & remove_mask ) {
+        SUDOKU_ASSERT ( get_cell_n_symbols( cell ) > 1 );       // in theory 0 or 1 is not possible
+        remove_cell_candidates( row, col, 1, remove_mask );     // remove single symbol mask
+        cell = get_cell( row, col );
+        if ( 1 == get_cell_n_symbols( cell ) ) return get_cell_map( cell );    // found a new naked single
     }
     return 0;
 }
@@ -84,9 +32,9 @@ static int check_col_of( int row, int col, int remove_mask, int *row_hint )
 static void set_naked_single_hint_desc_for_cell( int row, int col, bool *symbols,
                                                  bool trigger, hint_desc_t *hdesc )
 {
-    sudoku_cell_t *cell = get_cell( row, col );
-    if ( 1 == cell->n_symbols ) {
-        int sn = get_number_from_map( cell->symbol_map );
+    grid_cell_t cell = get_cell( row, col );
+    if ( 1 == get_cell_n_symbols( cell ) ) {
+        int sn = get_number_from_map( get_cell_map( cell ) );
         if ( symbols[ sn ] ) return;
 
         if ( trigger ) {
@@ -107,8 +55,8 @@ static bool set_naked_single_hint_desc( int row, int col, int symbol_mask, hint_
   printf("Setting naked single hint for row %d, col %d\n", row, col );
 #endif
 
-    int first_row = 3 * ( row / 3 );
-    int first_col = 3 * ( col / 3 );
+    int cell = row * SUDOKU_N_COLS + col;
+    const uint8_t *peers = cell_peers[ cell ];
 
     bool symbols[9] = { false }; // keep track of already triggered symbols
 
@@ -118,81 +66,80 @@ static bool set_naked_single_hint_desc( int row, int col, int symbol_mask, hint_
     hdesc->symbol_map = symbol_mask;
 
     // first indicate hint or triggers in current box (easier to spot)
+    const uint8_t *box_cells = unit_cells[ SUDOKU_N_SYMBOLS * UNIT_BOX + cell_units[ cell ][ UNIT_BOX ] ];
     for ( int i = 0; i < N_CELLS_PER_BOX; ++i ) {
-        int r = first_row + (i / 3);
-        int c = first_col + (i % 3);
+        int r = cell_units[ box_cells[i] ][ UNIT_ROW ];
+        int c = cell_units[ box_cells[i] ][ UNIT_COL ];
         set_naked_single_hint_desc_for_cell( r, c, symbols, (r != row || c != col), hdesc );
     }
 
-    // then indicate triggers in current row
-    for ( int c = 0; c <  SUDOKU_N_COLS; ++c ) {
-        if ( c >= first_col && c < first_col + 3 ) continue; // don't duplicate cells already in box
-        set_naked_single_hint_desc_for_cell( row, c, symbols, true, hdesc );
+    // then indicate triggers in current row (last 6 peers, outside box)
+    for ( int i = FIRST_ROW_PEER; i < SUDOKU_N_PEERS; ++i ) {
+        set_naked_single_hint_desc_for_cell( row, cell_units[ peers[i] ][ UNIT_COL ], symbols, true, hdesc );
     }
 
-    // finally indicate triggers in current col
-    for ( int r = 0 ; r < SUDOKU_N_ROWS; ++r ) {
-        if ( r >= first_row && r < first_row + 3 ) continue; // don't duplicate cells already in box or row
-        set_naked_single_hint_desc_for_cell( r, col, symbols, true, hdesc );
+    // finally indicate triggers in current col (6 peers after the box ones)
+    for ( int i = FIRST_COL_PEER; i < FIRST_ROW_PEER; ++i ) {
+        set_naked_single_hint_desc_for_cell( cell_units[ peers[i] ][ UNIT_ROW ], col, symbols, true, hdesc );
     }
     return true;
 }
 
 /* look for a cell in any row, col or box that has only one symbol
-    - if not found, return false (no naked single, no possible reduction).
+    - if not found, return 0 (no naked single, no possible reduction).
     - if found, remove that symbol in the whole row, col or box
     - if in the process of removing that symbol another cell
-    - gets to a single symbol, sets that cell as naked single hint */
+    - gets to a single symbol, sets that cell as naked single hint
+    - and keep looking for others until fct stops (see get_hints) */
 
-extern bool look_for_naked_singles( hint_desc_t *hdesc )
+extern int look_for_naked_singles( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
 {
+    int n_hints = 0;
     for ( int col = 0; col < SUDOKU_N_COLS; col++ ) {
         for ( int row = 0; row < SUDOKU_N_ROWS; row++ ) {
-            sudoku_cell_t *cell = get_cell( row, col );
-            if ( 1 == cell->n_symbols ) {
-                int remove_mask = cell->symbol_map;
-
-                int row_hint, col_hint;
-                int single_mask = check_box_of( row, col, remove_mask, &row_hint, &col_hint );
-                if ( single_mask ) {
-                    return set_naked_single_hint_desc( row_hint, col_hint, single_mask, hdesc );
-                }
-                single_mask = check_col_of( row, col, remove_mask, &row_hint );
-                if ( single_mask ) {
-                    return set_naked_single_hint_desc( row_hint, col, single_mask, hdesc );
-                }
-                single_mask = check_row_of( row, col, remove_mask, &col_hint );
-                if ( single_mask ) {
-                    return set_naked_single_hint_desc( row, col_hint, single_mask, hdesc );
+            grid_cell_t cell = get_cell( row, col );
+            if ( 1 == get_cell_n_symbols( cell ) ) {
+                int remove_mask = get_cell_map( cell );
+
+                // peers are in box, col and row order, as they were checked before
+                const uint8_t *peers = cell_peers[ row * SUDOKU_N_COLS + col ];
+                for ( int i = 0; i < SUDOKU_N_PEERS; ++i ) {
+                    int r = cell_units[ peers[i] ][ UNIT_ROW ], c = cell_units[ peers[i] ][ UNIT_COL ];
+                    int single_mask = remove_symbol( r, c, remove_mask );
+                    if ( single_mask ) {
+                        set_naked_single_hint_desc( r, c, single_mask, hdesc );
+                        ++n_hints;
+                        if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+                    }
                 }
             }
         }
     }
-    return false;
+    return n_hints;
 }
 
 /* 2. Look for hidden singles. This must be done after looking for
    naked singles in order to benefit from the pencil clean up. */
 
-static int check_only_possible_symbols_in_set( locate_t by, int ref, cell_ref_t *candidate )
+static int check_only_possible_symbols_in_set( locate_t by, int ref, int first_symbol, cell_ref_t *candidate )
 {
-    for ( int s = 0; s < SUDOKU_N_SYMBOLS; ++s ) {
-        int mask = get_map_from_number( s ), n_hits = 0;
+    for ( int s = first_symbol; s < SUDOKU_N_SYMBOLS; ++s ) {
+        int location_map = get_symbol_locations( by, s )[ref];
+        if ( 1 != get_n_bits_from_map( location_map ) ) continue;
 
-        for ( int i = 0; i < SUDOKU_N_SYMBOLS; ++i ) {
+        int mask = get_map_from_number( s ), i = 0;
+        for ( ; i < SUDOKU_N_SYMBOLS; ++i ) {
             cell_ref_t cr;
             get_cell_ref_in_set( by, ref, i, &cr );
-            sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-            if ( mask & cell->symbol_map ) {
-                if ( 1 == cell->n_symbols ) {     // single with symbol, exit set loop
-                    SUDOKU_ASSERT( 0 == n_hits );
-                    break;
-                }
-                if ( ++n_hits > 1 ) break;        // multiple possibilities, exit set loop
-                *candidate = cr;                  // remember the hit
+            grid_cell_t cell = get_cell( cr.row, cr.col );
+            if ( 1 == get_cell_n_symbols( cell ) && ( mask & get_cell_map( cell ) ) ) {
+                break;                            // single with symbol, exit set loop
             }
         }
-        if ( 1 == n_hits ) return mask;
+        if ( SUDOKU_N_SYMBOLS == i ) {
+            get_cell_ref_in_set( by, ref, get_number_from_map( location_map ), candidate );
+            return mask;
+        }
     }
     return -1;
 }
@@ -307,8 +254,8 @@ static void fill_box_rows_cols( int box, int row_hint, int col_hint,
         get_cell_ref_in_set( LOCATE_BY_BOX, box, i, &cr );
         if ( cr.row == row_hint && cr.col == col_hint ) continue;
 
-        sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-        if ( 1 == cell->n_symbols ) continue;
+        grid_cell_t cell = get_cell( cr.row, cr.col );
+        if ( 1 == get_cell_n_symbols( cell ) ) continue;
 
         if ( cr.row != row_hint ) {                     // hint row cannot be used
             if ( n_br && br[n_br-1].row == cr.row ) {   // rows always increment in a box
@@ -341,8 +288,8 @@ static void fill_box_rows_cols( int box, int row_hint, int col_hint,
 
 static void set_box_triggers( int box, int row_hint, int col_hint, int mask, hint_desc_t *hdesc )
 {
-    int first_row = 3 * ( box / 3 );
-    int first_col = 3 * ( box % 3 );
+    int first_row, first_col;
+    get_box_first_row_col( box, &first_row, &first_col );
 
     box_row_def_t trigger_rows[3];
     box_col_def_t trigger_cols[3];
@@ -357,8 +304,8 @@ static void set_box_triggers( int box, int row_hint, int col_hint, int mask, hin
         trigger_rows[i].trigger = -1;
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
             if ( c >= first_col && c < first_col + 3 ) continue;
-            sudoku_cell_t *cell = get_cell( trigger_rows[i].row, c );
-            if ( 1 == cell->n_symbols && ( mask & cell->symbol_map ) ) {
+            grid_cell_t cell = get_cell( trigger_rows[i].row, c );
+            if ( 1 == get_cell_n_symbols( cell ) && ( mask & get_cell_map( cell ) ) ) {
                 trigger_rows[i].trigger = c;
                 SUDOKU_HINT_TRACE( ("Validate: trigger_rows[%d].row=%d, trigger=%d\n",
                                     i, trigger_rows[i].row, trigger_rows[i].trigger) );
@@ -370,8 +317,8 @@ static void set_box_triggers( int box, int row_hint, int col_hint, int mask, hin
         trigger_cols[j].trigger = -1;
         for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
             if ( r >= first_row && r < first_row + 3 ) continue;
-            sudoku_cell_t *cell = get_cell( r, trigger_cols[j].col );
-            if ( 1 == cell->n_symbols && ( mask & cell->symbol_map ) ) {
+            grid_cell_t cell = get_cell( r, trigger_cols[j].col );
+            if ( 1 == get_cell_n_symbols( cell ) && ( mask & get_cell_map( cell ) ) ) {
                 trigger_cols[j].trigger = r;
                 SUDOKU_HINT_TRACE( ("Validate: trigger_cols[%d].col=%d, trigger=%d\n",
                                     j, trigger_cols[j].col, trigger_cols[j].trigger) );
@@ -437,13 +384,22 @@ static void set_hidden_single_triggers( locate_t by, int set, cell_ref_t *cr, in
     }
 }
 
-extern bool look_for_hidden_singles( hint_desc_t *hdesc )
+extern int look_for_hidden_singles( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
 {
+    bool found[ SUDOKU_N_CELLS ] = { false };   // same hidden single in several sets
+    int n_hints = 0;
     for ( int by = LOCATE_BY_BOX; by >= LOCATE_BY_ROW; --by ) {
         for ( int set = 0; set < SUDOKU_N_SYMBOLS; ++set ) {
-            cell_ref_t candidate;
-            int mask = check_only_possible_symbols_in_set( (locate_t)by, set, &candidate );
-            if ( -1 != mask ) {
+            for ( int s = 0; s < SUDOKU_N_SYMBOLS; ++s ) {
+                cell_ref_t candidate;
+                int mask = check_only_possible_symbols_in_set( (locate_t)by, set, s, &candidate );
+                if ( -1 == mask ) break;
+
+                s = get_number_from_map( mask );
+                int cell = candidate.row * SUDOKU_N_COLS + candidate.col;
+                if ( found[ cell ] ) continue;
+                found[ cell ] = true;
+
                 set_hidden_single_triggers( by, set, &candidate, mask, hdesc );
 
                 hint_desc_add_cell_ref_hint( hdesc, &candidate );
@@ -452,10 +408,11 @@ extern bool look_for_hidden_singles( hint_desc_t *hdesc )
                 hdesc->action = SET;
                 hdesc->n_symbols = 1;
                 hdesc->symbol_map = mask;
-                return true;
+                ++n_hints;
+                if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
             }
         }
     }
-    return false;
+    return n_hints;
 }
 
@@ -1,5 +1,5 @@
 
 #include "hint.h"
 
-extern bool look_for_naked_singles( hint_desc_t *hdesc );
-extern bool look_for_hidden_singles( hint_desc_t *hdesc );
+extern int look_for_naked_singles( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
+extern int look_for_hidden_singles( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
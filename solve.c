@@ -4,17 +4,28 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>   /* for performance measurements */
+#include <pthread.h>
 
 #include "sudoku.h"
 //#include "stack.h"
-#include "grdstk.h"
+#include "session.h"
 #include "grid.h"
 #include "solve.h"
-#include "hint.h"
 #include "rand.h"
+#include "pool.h"
+#include "bitboard.h"
+#include "lanes.h"
+#include "bank.h"
+#include "rate.h"
 
 #define DLX_DEBUG 0
 
+/* The engine used by new solvers and by the game can be selected at build time,
+   for example with make DEFINES=-DSUDOKU_DEFAULT_ENGINE=SUDOKU_DLX_ENGINE */
+#ifndef SUDOKU_DEFAULT_ENGINE
+#define SUDOKU_DEFAULT_ENGINE   SUDOKU_BITBOARD_ENGINE
+#endif
+
 /*
     Implements Knuth's DLX (Dancing Links XCOVER algorithm for SUDOKU
 */
@@ -22,24 +33,33 @@
 /* One node represents a specific constraint for each candidate.
    Each node in in two double linked circular lists,
     - one for multiple constraints to satisfy,
-    - one for each candidates to examine */
-typedef struct _node {
-    struct _node    *up, *down,     // up down in node list attached to header (see below)
-                    *left, *right;  // left, right in an entry node list
-    struct _header  *header;        // quick link back to constraint header
-} node_t;
-
-/* One header represents a constraint, and points to the first node of that constraint.
-   The number of nodes in the list is n_items, the root node included in the header does
-   not count: it just avoids special cases when handling the first and last node. The
-   number of items allows quick search of the constraint with the shortest number of
-   nodes (O(n_constraints) instead of O(n_constraints * n_nodes)). */
-typedef struct _header {
-    struct _node    root;           // embedded root node (header.root->down is first)
-    char            *name;          // this is for debugging purpose.
-    int             n_items;        // number of nodes attached to root
-    struct _header  *left, *right;  // header list
-} header_t;
+    - one for each candidates to examine
+
+   One header represents a constraint, and is the root node of the list of nodes
+   for that constraint. The number of nodes in the list is n_items, the header
+   does not count: it just avoids special cases when handling the first and last
+   node. Headers are themselves in a double linked circular list, starting at root.
+
+   In addition, each remaining header is in one of 10 bucket lists, according to
+   its number of items (0 to 9). Buckets are updated as items are covered and
+   uncovered, so that the constraint with the shortest number of nodes is found
+   in constant time, by looking at the first non-empty bucket, instead of going
+   through all remaining headers at each search level.
+
+   Instead of pointers, links are 16-bit indexes in a single index space:
+    - index 0 is root,
+    - indexes 1 to 324 are the constraint headers,
+    - indexes 325 to 3240 are the nodes, 9 per header, in header order.
+   For a header, left and right are links in the header list, and up and down
+   links in its node list. For a node, up and down are links in its header node
+   list and left and right links in its entry list. Since a node position never
+   changes, its header is computed from its index instead of being stored.
+
+   Links are kept in separate arrays (structure of arrays), which makes the
+   whole matrix about 26KB instead of 120KB with 64-bit pointers, so that it
+   remains in L1/L2 caches during a solve. Since it does not depend on its
+   address, the initial matrix is built once for all solvers and copied as is. */
+typedef uint16_t link_t;
 
 /* For sudoku, the constraints are:
     - for each cell, 1 symbol exactly (SUDOKU_N_ROWS*SUDOKU_N_COLS headers)
@@ -53,7 +73,6 @@ typedef struct _header {
 #define     N_BOX_CONSTRAINTS  (SUDOKU_N_BOXES*SUDOKU_N_SYMBOLS)
 
 #define     N_CONSTRAINTS   (N_CELL_CONSTRAINTS+N_ROW_CONSTRAINTS+N_COL_CONSTRAINTS+N_BOX_CONSTRAINTS)
-header_t    constraints[N_CONSTRAINTS]; // static allocation for 324 headers
 
 // constraint header locations
 #define FIRST_CELL_HEADER           0
@@ -61,10 +80,8 @@ header_t    constraints[N_CONSTRAINTS]; // static allocation for 324 headers
 #define FIRST_COL_SYMBOL_HEADER     (FIRST_ROW_SYMBOL_HEADER+N_ROW_CONSTRAINTS)
 #define FIRST_BOX_SYMBOL_HEADER     (FIRST_COL_SYMBOL_HEADER+N_COL_CONSTRAINTS)
 
-// the first header is pointed to by root
-header_t root;
-
-char *names[N_CONSTRAINTS] = {
+#if DLX_DEBUG      // header names, for debugging only
+static const char *const names[N_CONSTRAINTS] = {
     "r0c0", "r0c1", "r0c2", "r0c3", "r0c4", "r0c5", "r0c6", "r0c7", "r0c8",
     "r1c0", "r1c1", "r1c2", "r1c3", "r1c4", "r1c5", "r1c6", "r1c7", "r1c8",
     "r2c0", "r2c1", "r2c2", "r2c3", "r2c4", "r2c5", "r2c6", "r2c7", "r2c8",
@@ -105,6 +122,7 @@ char *names[N_CONSTRAINTS] = {
     "b7s1", "b7s2", "b7s3", "b7s4", "b7s5", "b7s6", "b7s7", "b7s8", "b7s9",
     "b8s1", "b8s2", "b8s3", "b8s4", "b8s5", "b8s6", "b8s7", "b8s8", "b8s9"
 };
+#endif
 
 /*
     Those headers define how nodes are woven in the constraint matrix.
@@ -181,26 +199,58 @@ char *names[N_CONSTRAINTS] = {
                          ((_entry / SUDOKU_N_SYMBOLS) % SUDOKU_N_COLS) / 3)
 
 /* To link all nodes corresponding to each entry,
-        find header by cell: header(cell) = headers[FIRST_CELL_HEADER+cell]
-        find header by row, symbol: header(row, symbol) = constraints[FIRST_ROW_SYMBOL_HEADER+row*9+symbol]
-        find header by col, symbol: header(col, symbol) = constraints[FIRST_COL_SYMBOL_HEADER+col*9+symbol]
-        find header by box, symbol: header(box, symbol) = constraints[FIRST_BOX_SYMBOL_HEADER+box*9+symvol] */
-
-#define CELL_HEADER(_cell)              constraints[FIRST_CELL_HEADER+(_cell)]
-#define ROW_SYMBOL_HEADER(_row,_symbol) constraints[FIRST_ROW_SYMBOL_HEADER+(_row)*9+(_symbol)]
-#define COL_SYMBOL_HEADER(_col,_symbol) constraints[FIRST_COL_SYMBOL_HEADER+(_col)*9+(_symbol)]
-#define BOX_SYMBOL_HEADER(_box,_symbol) constraints[FIRST_BOX_SYMBOL_HEADER+(_box)*9+(_symbol)]
+        find header by cell: header(cell) = FIRST_HEADER+FIRST_CELL_HEADER+cell
+        find header by row, symbol: header(row, symbol) = FIRST_HEADER+FIRST_ROW_SYMBOL_HEADER+row*9+symbol
+        find header by col, symbol: header(col, symbol) = FIRST_HEADER+FIRST_COL_SYMBOL_HEADER+col*9+symbol
+        find header by box, symbol: header(box, symbol) = FIRST_HEADER+FIRST_BOX_SYMBOL_HEADER+box*9+symbol */
 
 #define N_NODES     (N_CONSTRAINTS * SUDOKU_N_SYMBOLS)
-node_t nodes[N_NODES];                  // all links are initially NULL
+
+#define ROOT            0
+#define FIRST_HEADER    1
+#define FIRST_NODE      (FIRST_HEADER+N_CONSTRAINTS)
+#define N_LINKS         (FIRST_NODE+N_NODES)
+
+#define CELL_HEADER(_cell)              (FIRST_HEADER+FIRST_CELL_HEADER+(_cell))
+#define ROW_SYMBOL_HEADER(_row,_symbol) (FIRST_HEADER+FIRST_ROW_SYMBOL_HEADER+(_row)*9+(_symbol))
+#define COL_SYMBOL_HEADER(_col,_symbol) (FIRST_HEADER+FIRST_COL_SYMBOL_HEADER+(_col)*9+(_symbol))
+#define BOX_SYMBOL_HEADER(_box,_symbol) (FIRST_HEADER+FIRST_BOX_SYMBOL_HEADER+(_box)*9+(_symbol))
+
+// node at position _pos (0 to 8) in the header list, and the reverse
+#define HEADER_NODE(_header,_pos)   (FIRST_NODE+((_header)-FIRST_HEADER)*SUDOKU_N_SYMBOLS+(_pos))
+#define NODE_HEADER(_node)          (FIRST_HEADER+((_node)-FIRST_NODE)/SUDOKU_N_SYMBOLS)
+#define NODE_POSITION(_node)        (((_node)-FIRST_NODE)%SUDOKU_N_SYMBOLS)
+
+#define N_BUCKETS       (SUDOKU_N_SYMBOLS+1)        // from 0 to 9 items
+#define FIRST_BUCKET    FIRST_NODE                  // bucket list heads, after headers
+
+typedef struct {
+    link_t      up[N_LINKS], down[N_LINKS];     // up down in header node list
+    link_t      left[N_LINKS], right[N_LINKS];  // left, right in entry node list or header list
+    uint8_t     n_items[FIRST_NODE];            // number of nodes attached to each header
+    link_t      next[FIRST_BUCKET+N_BUCKETS],   // next, previous in bucket list
+                prev[FIRST_BUCKET+N_BUCKETS];
+} dlx_matrix_t;
+
+/* The initial matrix, shared by all solvers, is built only once. */
+static dlx_matrix_t pristine_matrix;
+static pthread_once_t pristine_matrix_once = PTHREAD_ONCE_INIT;
+
+/* A solver context owns a complete constraint matrix, so that as many solvers
+   as needed can run concurrently: nothing in the matrix is shared between
+   solvers and nothing is read from or written to the game grid stack. */
+struct sudoku_solver {
+    sudoku_engine_t engine;             // DLX or bitboard
+    dlx_matrix_t    matrix;             // working matrix, covered during a solve
+};
 
 typedef struct {
     int row, col, symbol;
 } rcs_t;
 
-static void get_rcs_from_node( node_t *node, rcs_t *rcs )
+static void get_rcs_from_node( link_t node, rcs_t *rcs )
 {
-    int hn = node->header - constraints, in = (node - nodes) % 9;
+    int hn = NODE_HEADER( node ) - FIRST_HEADER, in = NODE_POSITION( node );
 
     if ( hn < FIRST_ROW_SYMBOL_HEADER ) {
         rcs->row = hn / 9;
@@ -227,106 +277,124 @@ static void get_rcs_from_node( node_t *node, rcs_t *rcs )
 }
 
 #if DLX_DEBUG
-static char *get_entry_name( node_t *node )
+static const char *get_header_name( link_t header )
+{
+    return ( ROOT == header ) ? "root" : names[header - FIRST_HEADER];
+}
+
+static char *get_entry_name( link_t node )
 {
     // rebuilding the entry number from each header # and item #
     rcs_t  rcs;
     get_rcs_from_node( node, &rcs );
 
-    static char buffer[] = "r0c0s1";
+    static _Thread_local char buffer[] = "r0c0s1";
     buffer[1] = '0' + rcs.row;
     buffer[3] = '0' + rcs.col;
     buffer[5] = '1' + rcs.symbol;
     return buffer;
 }
 
-static void print_constraint( long int which )
+static void print_constraint( dlx_matrix_t *matrix, link_t header )
 {
-    assert( which >= 0 && which < N_CONSTRAINTS );
-    printf("Constraint %03ld: %s <- %s -> %s, %d nodes [",
-            which, constraints[which].left->name,
-            constraints[which].name, constraints[which].right->name,
-            constraints[which].n_items );
+    assert( header >= FIRST_HEADER && header < FIRST_NODE );
+    printf("Constraint %03d: %s <- %s -> %s, %d nodes [",
+            header - FIRST_HEADER, get_header_name( matrix->left[header] ),
+            get_header_name( header ), get_header_name( matrix->right[header] ),
+            matrix->n_items[header] );
 
-    for ( node_t *node = constraints[which].root.down; node != &constraints[which].root;
-                                                                         node = node->down ) {
+    for ( link_t node = matrix->down[header]; node != header; node = matrix->down[node] ) {
         printf( " ^%s", get_entry_name( node ) );
     }
     printf( " ]\n" );
 }
 
-static void print_entry( node_t *entry )
+static void print_entry( dlx_matrix_t *matrix, link_t entry )
 {
-    node_t *first = entry;
+    link_t first = entry;
 
-    while ( first->header >= &constraints[ FIRST_ROW_SYMBOL_HEADER ] ) {
-        first = first->left;
+    while ( NODE_HEADER( first ) >= FIRST_HEADER + FIRST_ROW_SYMBOL_HEADER ) {
+        first = matrix->left[first];
     }
 
     printf( "In entry: " );
-    node_t *node = first;
+    link_t node = first;
     do {
         if ( node == entry ) {
-            printf( " < %s >", node->header->name );
+            printf( " < %s >", get_header_name( NODE_HEADER( node ) ) );
         } else {
-            printf(" %s", node->header->name);
+            printf(" %s", get_header_name( NODE_HEADER( node ) ) );
         }
-        node = node->right;
+        node = matrix->right[node];
     } while ( node != first );
 
     int k = 1;
-    for( node = entry->header->root.down; node != entry; node = node->down ) ++k;
-    printf(" node #%d of %d\n", k, entry->header->n_items );
+    link_t header = NODE_HEADER( entry );
+    for( node = matrix->down[header]; node != entry; node = matrix->down[node] ) ++k;
+    printf(" node #%d of %d\n", k, matrix->n_items[header] );
 }
 
-static void print_all_constraints( void )
+static void print_all_constraints( dlx_matrix_t *matrix )
 {
-    for ( header_t *header = root.right; header != &root; header = header->right ) {
-        print_constraint( header - constraints );
+    for ( link_t header = matrix->right[ROOT]; header != ROOT; header = matrix->right[header] ) {
+        print_constraint( matrix, header );
     }
 }
 #endif
 
-static void sudoku_set_dlx_header_list( void )
+static inline void remove_from_bucket( dlx_matrix_t *matrix, link_t header )
 {
-    memset( nodes, 0, sizeof(nodes) );
-    node_t *node = nodes;                       // nodes are allocated from the array
+    link_t next = matrix->next[header], prev = matrix->prev[header];
+    matrix->next[prev] = next;
+    matrix->prev[next] = prev;
+}
 
-    for ( int i = 0; i < N_CONSTRAINTS; ++i ) { // first, constraint headers
-        constraints[i].name = names[i];
-        constraints[i].n_items = SUDOKU_N_SYMBOLS;
+static inline void insert_in_bucket( dlx_matrix_t *matrix, link_t header )
+{
+    link_t bucket = FIRST_BUCKET + matrix->n_items[header];
+    link_t next = matrix->next[bucket];
+    matrix->next[bucket] = matrix->prev[next] = header;
+    matrix->next[header] = next;
+    matrix->prev[header] = bucket;
+}
 
-        constraints[i].root.header = &constraints[i];
-        constraints[i].root.down = node;        // first in node list
+static void sudoku_set_dlx_header_list( dlx_matrix_t *matrix )
+{
+    for ( link_t header = FIRST_HEADER; header < FIRST_NODE; ++header ) {
+        matrix->n_items[header] = SUDOKU_N_SYMBOLS;
 
-        node->header = &constraints[i];
-        node->up = &constraints[i].root;
-        node->down = node + 1;
+        link_t node = HEADER_NODE( header, 0 );
+        matrix->down[header] = node;            // first in node list
+        matrix->up[node] = header;
 
         for ( int j = 0; j < SUDOKU_N_SYMBOLS-1; ++j ) {    // following 8 nodes point to each other
+            matrix->down[node] = node + 1;
+            matrix->up[node + 1] = node;
             ++node;
-            node->header = &constraints[i];
-            node->up = node - 1;
-            node->down = node + 1;
-        }   // header.first <-> node 0 <-> node 1 <-> ... <-> node 7 <-> &header.first
-        node->down = &constraints[i].root;    // fix & close circular link
-        constraints[i].root.up = node;
-
-        if ( i > 0 ) {
-            constraints[i-1].right = &constraints[i];
-            constraints[i].left = &constraints[i-1];
-        }
-        ++node;                                 // ready for next header
+        }   // header <-> node 0 <-> node 1 <-> ... <-> node 8 <-> header
+        matrix->down[node] = header;            // fix & close circular link
+        matrix->up[header] = node;
+    }
+
+    for ( link_t header = ROOT; header < FIRST_NODE; ++header ) {   // root first
+        matrix->right[header] = ( header == FIRST_NODE - 1 ) ? ROOT : header + 1;
+        matrix->left[header] = ( header == ROOT ) ? FIRST_NODE - 1 : header - 1;
     }
-    root.right = constraints;
-    constraints[0].left = &root;
+    matrix->n_items[ROOT] = 0;
 
-    root.left = &constraints[N_CONSTRAINTS-1];
-    constraints[N_CONSTRAINTS-1].right = &root;
-    root.name = "root";
+    for ( link_t bucket = FIRST_BUCKET; bucket < FIRST_BUCKET + N_BUCKETS; ++bucket ) {
+        matrix->next[bucket] = matrix->prev[bucket] = bucket;   // empty bucket
+    }
+    for ( link_t header = FIRST_NODE - 1; header >= FIRST_HEADER; --header ) {
+        insert_in_bucket( matrix, header );     // header 1 first in bucket 9
+    }
 }
 
-static void sudoku_set_dlx_entry_lists( void )
+static void sudoku_set_dlx_entry_lists( dlx_matrix_t *matrix )
+/* The nodes of header #h are at position 0 to 8 in its list, and the position of
+   an entry in each of its 4 headers is known: the symbol in its cell header, the
+   col in its row-symbol header, the row in its col-symbol header and the cell index
+   in the box in its box-symbol header. Entry lists are therefore linked directly. */
 {
     for ( int i = 0; i < N_ENTRIES; ++i ) {
         int symbol = SYMBOL(i);
@@ -335,224 +403,333 @@ static void sudoku_set_dlx_entry_lists( void )
         int col = COL(i);
         int box = BOX(i);
 
-        header_t *header = &CELL_HEADER(cell);
-        node_t *cell_node;
+        link_t cell_node = HEADER_NODE( CELL_HEADER(cell), symbol );
+        link_t row_node = HEADER_NODE( ROW_SYMBOL_HEADER(row, symbol), col );
+        link_t col_node = HEADER_NODE( COL_SYMBOL_HEADER(col, symbol), row );
+        link_t box_node = HEADER_NODE( BOX_SYMBOL_HEADER(box, symbol), (row % 3) * 3 + col % 3 );
 
-//        printf("#%03d", i);
-//        int n = 0;  // debug only
-        for ( cell_node = header->root.down; ; cell_node = cell_node->down ) {
-            if ( NULL == cell_node->right ) {
-//                printf(" in %s#%d", header->name, n);
-                break;
-            }
-//            ++n;
-            assert ( cell_node->down != &header->root );
-        }
-        header = &ROW_SYMBOL_HEADER(row, symbol);
-        node_t *row_node;
-//        n = 0;  // debug only
-        for ( row_node = header->root.down; ; row_node = row_node->down ) {
-            if ( NULL == row_node->right ) {
-//                printf(" in %s#%d", header->name, n);
-                break;
-            }
-//            ++n;
-            assert ( row_node->down != &header->root );
-        }
-        row_node->left = cell_node;
-        cell_node->right = row_node;
-
-        header = &COL_SYMBOL_HEADER(col, symbol);
-        node_t *col_node;
-//        n = 0;  // debug only
-        for ( col_node = header->root.down; ; col_node = col_node->down ) {
-            if ( NULL == col_node->right ) {
-//                printf(" in %s#%d", header->name, n);
-                break;
-            }
-//            ++n;
-            assert ( col_node->down != &header->root );
-        }
-        col_node->left = row_node;
-        row_node->right = col_node;
-
-        header = &BOX_SYMBOL_HEADER(box, symbol);
-        node_t *box_node;
-//        n = 0;  // debug only
-        for ( box_node = header->root.down; ; box_node = box_node->down ) {
-            if ( NULL == box_node->right ) {
-//                printf(" in %s#%d\n", header->name, n);
-                break;
-            }
-//            ++n;
-            assert ( box_node->down != &header->root );
-        }
-        box_node->left = col_node;
-        col_node->right = box_node;
+        matrix->left[row_node] = cell_node;
+        matrix->right[cell_node] = row_node;
 
-        cell_node->left = box_node;
-        box_node->right = cell_node;
+        matrix->left[col_node] = row_node;
+        matrix->right[row_node] = col_node;
+
+        matrix->left[box_node] = col_node;
+        matrix->right[col_node] = box_node;
+
+        matrix->left[cell_node] = box_node;
+        matrix->right[box_node] = cell_node;
     }
 }
 
-static void cover( header_t *header )
+static void sudoku_set_dlx_matrix( void )
 {
-    header_t *left = header->left, *right = header->right;
-    left->right = right;
-    right->left = left;
+    sudoku_set_dlx_header_list( &pristine_matrix ); // first header list
+    sudoku_set_dlx_entry_lists( &pristine_matrix ); // then the entry lists
+}
+
+static void cover( dlx_matrix_t *matrix, link_t header )
+{
+    link_t left = matrix->left[header], right = matrix->right[header];
+    matrix->right[left] = right;
+    matrix->left[right] = left;
+    remove_from_bucket( matrix, header );
 
     // cover nodes from top to bottom, right to left.
-    for ( node_t *node = header->root.down; node != &header->root ; node = node->down ) {
-        for ( node_t *next = node->right; next != node; next = next->right ) {
-            assert( next->header->n_items > 0 );
-            node_t *up = next->up, *down = next->down;
-            up->down = down;
-            down->up = up;
-            --next->header->n_items;
+    for ( link_t node = matrix->down[header]; node != header; node = matrix->down[node] ) {
+        for ( link_t next = matrix->right[node]; next != node; next = matrix->right[next] ) {
+            link_t next_header = NODE_HEADER(next);
+            assert( matrix->n_items[next_header] > 0 );
+            link_t up = matrix->up[next], down = matrix->down[next];
+            matrix->down[up] = down;
+            matrix->up[down] = up;
+
+            remove_from_bucket( matrix, next_header );  // move to the bucket below
+            --matrix->n_items[next_header];
+            insert_in_bucket( matrix, next_header );
         }
     }
 }
 
-static void uncover( header_t *header )
+static void uncover( dlx_matrix_t *matrix, link_t header )
 {
-    /* To take advantage of the dangling pointers still in the covered nodes,
+    /* To take advantage of the dangling links still in the covered nodes,
        uncover in exact reverse order. i.e. bottom to top, left to rignt. */
-    for ( node_t *node = header->root.up; node != &header->root; node = node->up ) {
-        for ( node_t *prev = node->left; prev != node; prev = prev->left ) {
-            node_t *up = prev->up;
-            node_t *down = prev->down;
-            up->down = down->up = prev;
-            ++prev->header->n_items;
+    for ( link_t node = matrix->up[header]; node != header; node = matrix->up[node] ) {
+        for ( link_t prev = matrix->left[node]; prev != node; prev = matrix->left[prev] ) {
+            link_t prev_header = NODE_HEADER(prev);
+            link_t up = matrix->up[prev];
+            link_t down = matrix->down[prev];
+            matrix->down[up] = matrix->up[down] = prev;
+
+            remove_from_bucket( matrix, prev_header );  // move to the bucket above
+            ++matrix->n_items[prev_header];
+            insert_in_bucket( matrix, prev_header );
         }
     }
-    header_t *left = header->left, *right = header->right;
-    left->right = right->left = header;
+    link_t left = matrix->left[header], right = matrix->right[header];
+    matrix->right[left] = matrix->left[right] = header;
+    insert_in_bucket( matrix, header );
 }
 
-static bool set_given( int row, int col, int symbol )
+static bool is_covered( dlx_matrix_t *matrix, link_t header )
 {
-//printf( "set_given: row %d col %d symbol %d\n", row, col, 1 + symbol );
+    return matrix->right[matrix->left[header]] != header;
+}
 
-    header_t *rc_header = &CELL_HEADER( row * SUDOKU_N_COLS + col ),
-             *rs_header = &ROW_SYMBOL_HEADER( row, symbol ),
-             *cs_header = &COL_SYMBOL_HEADER( col, symbol ),
-             *bs_header = &BOX_SYMBOL_HEADER( (row / 3) * 3 + col / 3, symbol );
+static bool set_given( dlx_matrix_t *matrix, int row, int col, int symbol )
+{
+    link_t rc_header = CELL_HEADER( row * SUDOKU_N_COLS + col ),
+           rs_header = ROW_SYMBOL_HEADER( row, symbol ),
+           cs_header = COL_SYMBOL_HEADER( col, symbol ),
+           bs_header = BOX_SYMBOL_HEADER( (row / 3) * 3 + col / 3, symbol );
 
-//printf( "rc header: %s, rs_header %s, cs_header %s, bs_header %s\n",
-//        rc_header->name, rs_header->name, cs_header->name, bs_header->name );
+    if ( is_covered( matrix, rc_header ) ) return false;
+    cover( matrix, rc_header );
 
-    if ( rc_header->left->right != rc_header ) {
-//        printf("rc_header %s already covered, exiting\n", rc_header->name );
-        return false;
-    }
-    cover( rc_header );
+    if ( is_covered( matrix, rs_header ) ) return false;
+    cover( matrix, rs_header );     // a constraint may get down to 0 node
 
-    if ( rs_header->left->right != rs_header ) {
-//        printf("rs_header %s already covered, exiting\n", rs_header->name );
-        return false;
-    }
-    cover( rs_header );     // a constraint may get down to 0 node
-
-    if ( cs_header->left->right != cs_header ) {
-//        printf("cs_header %s already covered, exiting\n", cs_header->name );
-        return false;
-    }
-    cover( cs_header );     // the error will be seen by the solver
+    if ( is_covered( matrix, cs_header ) ) return false;
+    cover( matrix, cs_header );     // the error will be seen by the solver
 
-    if ( bs_header->left->right != bs_header ) {
-//        printf("bs_header %s already covered, exiting\n", bs_header->name );
-        return false;
-    }
-    cover( bs_header );
+    if ( is_covered( matrix, bs_header ) ) return false;
+    cover( matrix, bs_header );
     return true;
 }
 
-static bool sudoku_set_dlx_constraints( void )
+static bool sudoku_set_dlx_constraints( sudoku_solver_t *solver, const sudoku_grid_t *puzzle )
 {
-    sudoku_set_dlx_header_list( );    // first header list
-    sudoku_set_dlx_entry_lists( );    // then the entry lists
+    dlx_matrix_t *matrix = &solver->matrix;
+
+    pthread_once( &pristine_matrix_once, sudoku_set_dlx_matrix );
+    *matrix = pristine_matrix;              // restore the initial matrix in one copy
 
     for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( 1 == cell->n_symbols &&
-                 ! set_given( r, c, get_number_from_map( cell->symbol_map ) ) )
+            int symbol = puzzle->cells[r * SUDOKU_N_COLS + c];
+            if ( SUDOKU_EMPTY_CELL == symbol ) continue;
+
+            if ( symbol < 1 || symbol > SUDOKU_N_SYMBOLS ||
+                 ! set_given( matrix, r, c, symbol - 1 ) )
                 return false;
         }
     }
-//    print_grid( );
     return true;
 }
 
-static void store_solution( node_t **solution, int n )
+static void store_solution( link_t *solution, int n, sudoku_grid_t *grid )
 {
     while ( n-- ) {
         rcs_t  rcs;
         get_rcs_from_node( *solution, &rcs );
-        set_cell_symbol( rcs.row, rcs.col, rcs.symbol, false );
+        grid->cells[rcs.row * SUDOKU_N_COLS + rcs.col] = (int8_t)(1 + rcs.symbol);
         ++solution;
     }
 }
 
-static int solve( int n_solutions ) // returns number of solutions, up to n_solutions.
+static int solve( dlx_matrix_t *matrix, int n_solutions, sudoku_grid_t *grid )
+// returns number of solutions, up to n_solutions. The first one is stored in grid if not NULL.
 {
     int level = 0, count = 0;
-    node_t *solution[SUDOKU_N_SYMBOLS*SUDOKU_N_SYMBOLS]; // list of currently chosen candidates
+    link_t solution[SUDOKU_N_SYMBOLS*SUDOKU_N_SYMBOLS]; // list of currently chosen candidates
 
     while ( true ) {                        // forward loop: deterministically select constraint
 
-        int min_items = SUDOKU_N_SYMBOLS + 1;
-        header_t *best_header = NULL;
+        link_t best_header = ROOT;
 
-        // find header with the lowest number of items, in O(number of headers).
-        for ( header_t *header = root.right; header != &root; header = header->right ) {
-            if ( header->n_items < min_items ) {
-                best_header = header;
-                min_items = header->n_items;
+        // find header with the lowest number of items, in the first non-empty bucket.
+        for ( link_t bucket = FIRST_BUCKET; bucket < FIRST_BUCKET + N_BUCKETS; ++bucket ) {
+            if ( matrix->next[bucket] != bucket ) {
+                best_header = matrix->next[bucket];
+                break;
             }
         }
-        assert( best_header );  // can be removed (and best_header not initialized) after testing
-        assert( best_header->n_items >= 0 );
-//        printf( "Selected header %s n_items %d\n", best_header->name, best_header->n_items );
+        assert( ROOT != best_header );
 
         // remove that header and set its first node in the expected solution stack
-        cover( best_header );
-        node_t *node = solution[level] = best_header->root.down;
+        cover( matrix, best_header );
+        link_t node = solution[level] = matrix->down[best_header];
 
         while ( true ) {                    // advance loop: cover other constraints for same entry
-            if ( node != &best_header->root ) {
-                for ( node_t *right = node->right; right != node; right = right->right ) {
-                    cover( right->header );         // cover all neighboring node's headers
+            if ( node != best_header ) {
+                for ( link_t right = matrix->right[node]; right != node; right = matrix->right[right] ) {
+                    cover( matrix, NODE_HEADER(right) );    // cover all neighboring node's headers
                 }
 
-                if ( root.right != &root ) {        // more constraints exist, matrix is not empty
+                if ( matrix->right[ROOT] != ROOT ) {    // more constraints exist, matrix is not empty
                     ++level;
                     break;                  // break from advance loop, next forward
                 }
 
-                if ( 0 == count ) store_solution( solution, 1 + level );
+                if ( 0 == count && grid ) store_solution( solution, 1 + level, grid );
                 if ( ++count == n_solutions )       // empty matrix: one more solution
                     return n_solutions;             // enough to stop now
                 
             } else {                                // no more constraint constraint, backup
-                uncover( best_header );
+                uncover( matrix, best_header );
                 if ( 0 == level ) {
                     return count;                   // return without additional solution
                 }
 
                 --level;
                 node = solution[level];
-                best_header = node->header;
+                best_header = NODE_HEADER(node);
             }
                                                     // recover: uncover all neighboring node's headers
-            for ( node_t *left = node->left; left != node; left = left->left ) {
-                uncover( left->header );
+            for ( link_t left = matrix->left[node]; left != node; left = matrix->left[left] ) {
+                uncover( matrix, NODE_HEADER(left) );
             }
-            node = solution[level] = node->down;    // and try another node
+            node = solution[level] = matrix->down[node];    // and try another node
         }                                           // next advance loop
     }
 }
 
+extern sudoku_solver_t *sudoku_solver_new( void )
+{
+    sudoku_solver_t *solver = malloc( sizeof(sudoku_solver_t) );
+    if ( solver ) solver->engine = SUDOKU_DEFAULT_ENGINE;
+    return solver;
+}
+
+extern void sudoku_solver_set_engine( sudoku_solver_t *solver, sudoku_engine_t engine )
+{
+    solver->engine = engine;
+}
+
+extern void sudoku_solver_free( sudoku_solver_t *solver )
+{
+    free( solver );
+}
+
+extern int sudoku_solver_solve( sudoku_solver_t *solver, const sudoku_grid_t *puzzle,
+                                int n_solutions, sudoku_grid_t *solution )
+{
+    if ( n_solutions < 1 ) n_solutions = 1;
+    if ( SUDOKU_BITBOARD_ENGINE == solver->engine ) {
+        return bitboard_solve( puzzle, n_solutions, solution );
+    }
+
+    sudoku_grid_t grid = *puzzle;           // solution and puzzle may be the same grid
+    if ( ! sudoku_set_dlx_constraints( solver, &grid ) ) return 0;
+
+    int count = solve( &solver->matrix, n_solutions, &grid );
+    if ( count && solution ) *solution = grid;
+    return count;
+}
+
+
+/* A batch is solved by a pool of workers, each one with its own solver. Items
+   given to workers are either single puzzles or groups of N_LANES puzzles. */
+typedef struct {
+    const sudoku_grid_t *puzzles;
+    sudoku_grid_t       *solutions;
+    uint8_t             *n_solutions;
+    size_t              n_puzzles;
+    sudoku_solver_t     **solvers;          // one per worker
+} batch_t;
+
+static void solve_batch_item( void *cntxt, int worker, size_t item )
+{
+    batch_t *batch = cntxt;
+    sudoku_grid_t *solution = ( batch->solutions ) ? &batch->solutions[item] : NULL;
+    batch->n_solutions[item] = (uint8_t)sudoku_solver_solve( batch->solvers[worker],
+                                                             &batch->puzzles[item], 2, solution );
+}
+
+static void solve_batch_lanes( void *cntxt, int worker, size_t item )
+{
+    batch_t *batch = cntxt;
+    size_t first = item * N_LANES;
+    int n_puzzles = ( batch->n_puzzles - first < N_LANES ) ? (int)(batch->n_puzzles - first) : N_LANES;
+    sudoku_grid_t *solutions = ( batch->solutions ) ? &batch->solutions[first] : NULL;
+    lanes_solve( batch->solvers[worker], &batch->puzzles[first], n_puzzles,
+                 solutions, &batch->n_solutions[first] );
+}
+
+static bool run_batch( const sudoku_grid_t *puzzles, sudoku_grid_t *solutions,
+                       uint8_t *n_solutions, size_t n_puzzles, int n_threads,
+                       size_t n_items, pool_task_fct_t task )
+{
+    if ( 0 == n_items ) return true;
+    if ( n_threads < 1 ) n_threads = get_pool_default_n_workers( );
+    if ( (size_t)n_threads > n_items ) n_threads = (int)n_items;
+
+    batch_t batch = { puzzles, solutions, n_solutions, n_puzzles, NULL };
+    batch.solvers = calloc( n_threads, sizeof(sudoku_solver_t *) );
+    if ( NULL == batch.solvers ) return false;
+
+    bool done = false;
+    int w = 0;
+    for ( ; w < n_threads; ++w ) {
+        batch.solvers[w] = sudoku_solver_new( );
+        if ( NULL == batch.solvers[w] ) break;
+    }
+    if ( w == n_threads ) {
+        done = pool_run( n_threads, n_items, task, &batch );
+    }
+    while ( w-- ) {
+        sudoku_solver_free( batch.solvers[w] );
+    }
+    free( batch.solvers );
+    return done;
+}
+
+extern bool sudoku_solve_batch( const sudoku_grid_t *puzzles, sudoku_grid_t *solutions,
+                                uint8_t *n_solutions, size_t n_puzzles, int n_threads )
+{
+    return run_batch( puzzles, solutions, n_solutions, n_puzzles, n_threads,
+                      n_puzzles, solve_batch_item );
+}
+
+extern bool sudoku_solve_lane_batch( const sudoku_grid_t *puzzles, sudoku_grid_t *solutions,
+                                     uint8_t *n_solutions, size_t n_puzzles, int n_threads )
+{
+    return run_batch( puzzles, solutions, n_solutions, n_puzzles, n_threads,
+                      ( n_puzzles + N_LANES - 1 ) / N_LANES, solve_batch_lanes );
+}
+
+/* Each game session has its own solver, allocated the first time it is needed. */
+static sudoku_solver_t *get_game_solver( sudoku_session_t *session )
+{
+    if ( NULL == session->solver ) {
+        session->solver = sudoku_solver_new( );
+    }
+    return session->solver;
+}
+
+extern void sudoku_set_game_engine( sudoku_session_t *session, sudoku_engine_t engine )
+{
+    set_session( session );
+    sudoku_solver_t *solver = get_game_solver( session );
+    if ( solver ) sudoku_solver_set_engine( solver, engine );
+}
+
+static void get_game_grid( sudoku_grid_t *grid )
+{
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            grid_cell_t cell = get_cell( r, c );
+            grid->cells[r * SUDOKU_N_COLS + c] = ( 1 == get_cell_n_symbols( cell ) ) ?
+                            (int8_t)(1 + get_number_from_map( get_cell_map( cell ) )) :
+                            SUDOKU_EMPTY_CELL;
+        }
+    }
+}
+
+// set the symbols of solution in the game grid cells that are empty in puzzle
+static void set_solution_in_game_grid( const sudoku_grid_t *puzzle, const sudoku_grid_t *solution )
+{
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            int i = r * SUDOKU_N_COLS + c;
+            if ( SUDOKU_EMPTY_CELL == puzzle->cells[i] ) {
+                set_cell_symbol( r, c, solution->cells[i] - 1, false );
+            }
+        }
+    }
+}
+
 static int solve_grid( bool multiple )
 /* return 0, 1 or 2 according to the following table
 
@@ -564,15 +741,100 @@ static int solve_grid( bool multiple )
        true       1         1
        true       >1        2 */
 {
+    sudoku_solver_t *solver = get_game_solver( get_session( ) );
+    if ( NULL == solver ) return 0;
+
+    sudoku_grid_t puzzle, solution;
+
     game_new_grid();
-    if ( ! sudoku_set_dlx_constraints() ) return 0;
-    return solve( ( multiple ) ? 2 : 1 );   // solved grid, if any, is on top of stack
+    get_game_grid( &puzzle );
+    int res = sudoku_solver_solve( solver, &puzzle, ( multiple ) ? 2 : 1, &solution );
+
+    if ( res ) {                            // solved grid is on top of stack
+        set_solution_in_game_grid( &puzzle, &solution );
+    }
+    return res;
+}
+
+/* Once the unique solution of the game puzzle is known, the game grid can still
+   be solved if and only if all its singles are in that solution, since any
+   solution of the grid is a solution of the puzzle, whose givens are singles. */
+static bool is_in_solution( const sudoku_grid_t *grid, const sudoku_grid_t *solution )
+{
+    for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+        if ( SUDOKU_EMPTY_CELL != grid->cells[i] && solution->cells[i] != grid->cells[i] ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+extern int check_game_solution( void )
+{
+    const sudoku_grid_t *solution = get_game_solution( );
+    if ( NULL == solution ) return -1;
+
+    sudoku_grid_t grid;
+    get_game_grid( &grid );
+    return is_in_solution( &grid, solution );
+}
+
+static void get_givens( sudoku_grid_t *puzzle )
+// get the puzzle made of the givens in the current grid
+{
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            grid_cell_t cell = get_cell( r, c );
+            puzzle->cells[r * SUDOKU_N_COLS + c] = ( is_given_cell( cell ) ) ?
+                            (int8_t)(1 + get_number_from_map( get_cell_map( cell ) )) :
+                            SUDOKU_EMPTY_CELL;
+        }
+    }
+}
+
+extern void set_game_puzzle_from_givens( void )
+{
+    sudoku_solver_t *solver = get_game_solver( get_session( ) );
+    if ( NULL == solver ) return;
+
+    sudoku_grid_t puzzle, solution;
+    get_givens( &puzzle );
+    int res = sudoku_solver_solve( solver, &puzzle, 2, &solution );
+    set_game_solution( ( 1 == res ) ? &solution : NULL );
+    if ( 1 == res ) {
+        set_solve_path_puzzle( &get_session()->path, &puzzle );
+    } else {
+        clear_solve_path( &get_session()->path );
+    }
+}
+
+extern void rate_game_puzzle( void )
+{
+    int score = 0;
+    if ( get_game_solution( ) ) {
+        sudoku_grid_t puzzle;
+        get_givens( &puzzle );
+        sudoku_hint_stats_t hstats;
+        set_game_level( sudoku_rate_puzzle( &puzzle, &hstats ) );
+        score = hstats.score;
+    }
+    set_game_score( score );
 }
 
 extern bool find_one_solution( void )
 {
     if (is_game_solved()) return true;
-    return (bool)solve_grid( false );
+
+    const sudoku_grid_t *solution = get_game_solution( );
+    if ( NULL == solution ) return (bool)solve_grid( false );
+
+    sudoku_grid_t puzzle;
+    get_game_grid( &puzzle );
+    if ( ! is_in_solution( &puzzle, solution ) ) return false;
+
+    game_new_grid();                        // same as solve_grid
+    set_solution_in_game_grid( &puzzle, solution );
+    return true;
 }
 
 extern int check_current_grid( void )
@@ -597,138 +859,78 @@ extern int check_current_grid( void )
     return res;
 }
 
-#define MAX_TRIALS  1000        // safety measure
-
-static bool solve_random_cell_array( unsigned int seed )
+/* A random game is made in two steps: first a random complete grid is filled in
+   a single randomized search, then givens are removed in random order, as long
+   as the puzzle keeps a unique solution, until n_givens are left or no given can
+   be removed. Since the solution is known, removing a given keeps it unique if no
+   solution exists with another symbol in its cell, which requires a single search.
+   Each search starts again from the givens left: removing a given only adds
+   candidates, which the propagated state of a previous search cannot give back. */
+extern void make_random_puzzle( random_state_t *random, int n_givens,
+                                sudoku_grid_t *puzzle, sudoku_grid_t *solution )
 {
-    if ( 0 != seed ) set_random_seed( seed );
+    sudoku_grid_t grid;
+    if ( NULL == solution ) solution = &grid;
+    bitboard_fill_random( random, solution );
+    *puzzle = *solution;
+
+    int order[SUDOKU_N_CELLS];
+    for ( int i = 0; i < SUDOKU_N_CELLS; ++i ) {
+        order[i] = i;
+    }
+    for ( int i = SUDOKU_N_CELLS - 1; i > 0; --i ) {
+        int j = random_state_value( random, 0, i );
+        int cell = order[i];
+        order[i] = order[j];
+        order[j] = cell;
+    }
 
-    reset_game();
-    int n_trials = 0;
-
-//                solve_count = true;
-
-    while ( true ) {
-        int col = random_value( 0, SUDOKU_N_COLS-1 );
-        int row = random_value( 0, SUDOKU_N_ROWS-1 );
-
-        sudoku_cell_t *cell = get_cell( row, col );
-        if ( 1 != cell->n_symbols ) {
-            int symbol = random_value( 0, SUDOKU_N_SYMBOLS-1 );
-
-//            printf("Given symbol %c @random row %d, col %d\n", '1'+symbol, row, col );
-            cell->state = SUDOKU_GIVEN;
-            cell->symbol_map = get_map_from_number( symbol );
-            cell->n_symbols = 1;
-
-            int res = solve_grid( true );
-            SUDOKU_SOLVE_TRACE( ("solve_random_cell_array: solve_grid returned %d\n", res) );
-            reset_stack();
-
-            if ( 1 == res ) break;  // exactly one solution, stop
-            if ( 0 == res ) {       // no solution, remove symbol and keep trying
-                cell->state = 0;
-                cell->symbol_map = 0;
-                cell->n_symbols = 0;
-            }                       // else multiple solutions, keep trying
-            if ( ++n_trials > MAX_TRIALS ) return false;
+    int n_left = SUDOKU_N_CELLS;
+    for ( int i = 0; i < SUDOKU_N_CELLS && n_left > n_givens; ++i ) {
+        int cell = order[i];
+        puzzle->cells[cell] = SUDOKU_EMPTY_CELL;
+        if ( bitboard_has_other_solution( puzzle, cell, solution->cells[cell] ) ) {
+            puzzle->cells[cell] = solution->cells[cell];  // needed, put it back
+        } else {
+            --n_left;
         }
     }
-    SUDOKU_SOLVE_TRACE( ("Generated unique solution grid with %d symbols @level %d\n",
-                         count_single_symbol_cells(), get_sp()) );
-#if SUDOKU_SOLVE_DEBUG
-    print_grid_pencils();
-#endif
-    return true;
 }
 
-typedef struct {
-    int n_naked_singles, n_hidden_singles;
-    int n_locked_candidates;
-    int n_naked_subsets, n_hidden_subsets;
-    int n_fishes, n_xy_wings, n_chains;
-} hint_stats_t;
+/* Numbered games are not dug down to minimal puzzles, which are much harder on
+   average (about 40% DIFFICULT instead of 3%). Keeping between 31 and 36 givens
+   gives the level mix of the games made originally by adding random givens until
+   the solution was unique: about 95% EASY, 1% SIMPLE and 3% DIFFICULT. */
+#define MIN_GAME_GIVENS     31
+#define MAX_GAME_GIVENS     36
 
-static void print_hint_stats( hint_stats_t *hstats )
+extern void make_numbered_puzzle( int game_nb, sudoku_grid_t *puzzle, sudoku_grid_t *solution )
 {
-    printf( "#Level determination:\n" );
-    printf( "  naked singles: %d\n", hstats->n_naked_singles );
-    printf( "  hidden singles: %d\n", hstats->n_hidden_singles );
-    printf( "  locked candidates: %d\n", hstats->n_locked_candidates );
-    printf( "  naked subsets: %d\n", hstats->n_naked_subsets );
-    printf( "  hidden subsets: %d\n", hstats->n_hidden_subsets );
-    printf( "  X-wings, fishes: %d\n", hstats->n_fishes );
-    printf( "  XY-wings: %d\n", hstats->n_xy_wings );
-    printf( "  chains: %d\n", hstats->n_chains );
+    random_state_t random;
+    set_random_state_seed( &random, (uint64_t)game_nb );
+    int n_givens = random_state_value( &random, MIN_GAME_GIVENS, MAX_GAME_GIVENS );
+    make_random_puzzle( &random, n_givens, puzzle, solution );
 }
 
-static sudoku_level_t assess_hint_stats( hint_stats_t *hstats )
+static void set_givens( const sudoku_grid_t *puzzle )
+// set the puzzle givens in the current grid, which must be empty
 {
-    print_hint_stats( hstats );
-
-    if ( hstats->n_chains || hstats->n_fishes || hstats->n_xy_wings ) return DIFFICULT;
-
-    if ( hstats->n_hidden_subsets ) return MODERATE;
-
-    if ( hstats->n_naked_subsets || hstats->n_locked_candidates ) return SIMPLE;
-
-    return EASY;
-}
-
-static sudoku_level_t evaluate_level( void )
-{
-//    print_grid_pencils(); // before
-    game_new_filled_grid();
-//    print_grid_pencils(); // after
+    for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
+        for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
+            int symbol = puzzle->cells[r * SUDOKU_N_COLS + c];
+            if ( SUDOKU_EMPTY_CELL == symbol ) continue;
 
-    hint_stats_t hstats = { 0 };
-    hint_desc_t hdesc;
-    while ( true ) {
-        if ( ! get_hint( &hdesc ) ) break;  // no hint
-#if 0
-        printf("@act_on_hint:\n");
-        printf("  hint_type %d\n", hdesc.hint_type);
-        printf("  n_hints %d\n", hdesc.n_hints);
-        printf("  n_triggers %d\n", hdesc.n_triggers);
-        printf("  action %d n_symbols=%d, map=0x%03x\n",
-               hdesc.action, hdesc.n_symbols, hdesc.symbol_map);
-#endif
-        switch( hdesc.hint_type ) {
-        case NO_HINT: case NO_SOLUTION:
-            SUDOKU_ASSERT( 0 );
-        case NAKED_SINGLE:
-            ++hstats.n_naked_singles;
-            break;
-        case HIDDEN_SINGLE:
-            ++hstats.n_hidden_singles;
-            break;
-        case LOCKED_CANDIDATE:
-            ++hstats.n_locked_candidates;
-            break;
-        case NAKED_SUBSET:
-            ++hstats.n_naked_subsets;
-            break;
-        case HIDDEN_SUBSET:
-            ++hstats.n_hidden_subsets;
-            break;
-        case XWING: case SWORDFISH: case JELLYFISH:
-            ++hstats.n_fishes;
-            break;
-        case XY_WING:
-            ++hstats.n_xy_wings;
-            break;
-        case CHAIN:
-            ++hstats.n_chains;
-            break;
+            set_cell_symbol( r, c, symbol - 1, true );
         }
-        if ( act_on_hint( &hdesc ) ) return assess_hint_stats( &hstats );
     }
-    print_hint_stats( &hstats );
-    printf( "Stopped at NO_HINT\n" );
-    return DIFFICULT;
+    SUDOKU_SOLVE_TRACE( ("Generated unique solution grid with %d symbols @level %d\n",
+                         count_single_symbol_cells(), get_sp()) );
+#if SUDOKU_SOLVE_DEBUG
+    print_grid_pencils();
+#endif
 }
 
-extern sudoku_level_t make_game( int game_nb )
+extern sudoku_level_t make_game( int game_nb, int *score )
 {
 #ifdef TIME_MEASURE
     time_t start_time, end_time;
@@ -737,10 +939,22 @@ extern sudoku_level_t make_game( int game_nb )
 #endif /* TIME_MREASURE */
 
     printf("SUDOKU game_nb %d\n", game_nb );
-    if ( ! solve_random_cell_array( game_nb ) ) {
-        printf("solve_random_cell_array did not find a unique solution!\n");
-        exit(1);
+    sudoku_grid_t puzzle, solution;
+    sudoku_level_t level;
+    sudoku_hint_stats_t hstats;
+    if ( get_bank_game( game_nb, &puzzle, &solution, &level, score ) ) {
+        reset_game();
+        set_givens( &puzzle );
+        set_game_solution( &solution );
+        set_solve_path_puzzle( &get_session()->path, &puzzle );
+        return level;
     }
+
+    make_numbered_puzzle( game_nb, &puzzle, &solution );
+    reset_game();
+    set_givens( &puzzle );
+    set_game_solution( &solution );
+    set_solve_path_puzzle( &get_session()->path, &puzzle );
 printf("SUDOKU game nb %d solved\n", game_nb );
 //    reduce_n_given();
 
@@ -752,9 +966,9 @@ printf("SUDOKU game nb %d solved\n", game_nb );
     }
 #endif /* TIME_MEASURE */
 
-    reset_stack( );
-    sudoku_level_t level = evaluate_level( );
+    level = sudoku_rate_puzzle( &puzzle, &hstats );
+    print_hint_stats( &hstats );
+    *score = hstats.score;
     printf("Difficulty level %d\n", level );
-    reset_stack();
     return level;
 }
@@ -8,9 +8,36 @@
 #define __SOLVE_H__
 
 #include "game.h"
+#include "rand.h"
 
 extern int check_current_grid( void );
 extern bool find_one_solution( void );
-extern sudoku_level_t make_game( int game_number );
+
+/* return 1 if the game grid can still be solved, 0 if it cannot, or -1 if the game
+   solution is not known, from the game solution only, without any search. */
+extern int check_game_solution( void );
+
+/* check that the givens in the game grid have a unique solution, and if so, make it
+   the game solution and record the solve path of the puzzle (see hint.h). */
+extern void set_game_puzzle_from_givens( void );
+
+/* rate the givens in the game grid and make it the game level and score, after
+   set_game_puzzle_from_givens. The score is 0 (unknown) if the puzzle does not
+   have a unique solution, the level being left unchanged. */
+extern void rate_game_puzzle( void );
+
+/* make the game of a game number, and return its level and its score */
+extern sudoku_level_t make_game( int game_number, int *score );
+
+/* make a random puzzle with a unique solution, drawing from the random state, and
+   return its solution if solution is not NULL. Givens are removed down to n_givens,
+   or until none can be removed if n_givens is 0, giving a minimal puzzle. It does
+   not use the game grid and it can be called from any thread. */
+extern void make_random_puzzle( random_state_t *random, int n_givens,
+                                sudoku_grid_t *puzzle, sudoku_grid_t *solution );
+
+/* make the puzzle of a game number, always the same for a given number, and its
+   solution if solution is not NULL. */
+extern void make_numbered_puzzle( int game_nb, sudoku_grid_t *puzzle, sudoku_grid_t *solution );
 
 #endif /* __SOLVE_H__ */
@@ -1,7 +1,7 @@
 
 /* Undo/Redo stack manipulation for sudoku operations */
 
-#include "stack.h"
+#include "session.h"
 
 /*
   undo/redo stack:
@@ -10,20 +10,17 @@
   grids is managed.
 
   bottom_stack is the bottom of Stack.
-  stack_pointer is the theoretical stack pointer.
+  stack_pointer is the stack pointer.
 
-  Note that stack_pointer and bottom_stack are always incrementing as if the 
-  stack was infinite. The actual stack index is stack_pointer modulo the
-  stack size.
+  The stack is not limited, since grids are stored as changes from one grid
+  to the next (see grdstk.c). The stack index is the stack pointer itself.
+  Both are kept in the current session.
 */
-#define STACK_INDEX(_sp)  ((int)((_sp) % MAX_DEPTH))
+#define STACK_INDEX(_sp)  ((int)(_sp))
 /*
-  stack is empty if ( stack_pointer == bottom_stack + 1 ) modulo N
-  stack is full if ( stack_pointer == bottom_stack ) modulo N
+  stack is empty if ( stack_pointer == bottom_stack + 1 )
 */
-#define IS_STACK_EMPTY() ((stack_pointer % MAX_DEPTH) ==    \
-                          ((bottom_stack+1) % MAX_DEPTH))
-#define IS_STACK_FULL()  ((stack_pointer % MAX_DEPTH) == (bottom_stack % MAX_DEPTH))
+#define IS_STACK_EMPTY(_s) ((_s)->stack_pointer == (_s)->bottom_stack + 1)
 
 /*
   initially stack is empty:
@@ -32,95 +29,74 @@
   |stack_pointer = 1
   ||
   vv
-  [------------------[
-  0                  N = MAX_DEPTH
+  [------------------ ...
+  0
 
-  The functioning condtions are that:
-  - bottom_stack is always less than or equal to stack_pointer.
-  - the stack is never full (bottom_stack == stack_pointer).
-
-  Which can be summarized as bottom_stack < stack_pointer;
+  The functioning condition is that bottom_stack < stack_pointer;
 */
-static stack_pointer_t stack_pointer = 1, bottom_stack = 0;
+#define STACK_IS_OK(_s) ((_s)->bottom_stack < (_s)->stack_pointer)
 
-#define STACK_IS_OK() (bottom_stack < stack_pointer)
+static inline stack_state_t *get_stack_state( void )
+{
+    return &get_session()->stack;
+}
 
 /*
-  If stack is full, then the bottom of stack bS is automatically incremented
-  (modulo N) to make room for one more new state, and as a consequence the
-  oldest state saved in stack is lost (that is if we do not cross the low
-  water mark - see more below).
-
-          sp   | wall protecting entries above low water mark
-           |bs |
-           ||  |
-           vv  |
-  [########-#########[
-               ^
-               |
-        low water mark modulo N
-
-   Low water mark makes sure we do not remove that value from the stack
-   when wrapping around and removing old entries in case of overflow.
-   If that situation occurs, the push operation fails and the game stops.
-   With a large stack, this occurence is extremely unlikely.
+  Low water mark makes sure a game saved for solving can always be restored.
+  Since old entries are never removed from the stack, it is only checked when
+  going back to a previous stack pointer.
  */
-static stack_pointer_t low_water_mark = 0;
-
 extern void set_low_water_mark( stack_pointer_t mark )
 {
-    if ( ( 0 == low_water_mark ) || ( low_water_mark > mark ) )
-        low_water_mark = mark;
+    stack_state_t *stack = get_stack_state( );
+    if ( ( 0 == stack->low_water_mark ) || ( stack->low_water_mark > mark ) )
+        stack->low_water_mark = mark;
 }
 
 extern stack_pointer_t get_low_water_mark( void )
 {
-    return low_water_mark;
+    return get_stack_state( )->low_water_mark;
 }
 
 extern stack_index_t reset_stack( void )
 {
-    stack_pointer = 1;
-    bottom_stack = 0;
-    low_water_mark = 0;
-    return STACK_INDEX(stack_pointer);
+    stack_state_t *stack = get_stack_state( );
+    stack->stack_pointer = 1;
+    stack->bottom_stack = 0;
+    stack->low_water_mark = 0;
+    return STACK_INDEX(stack->stack_pointer);
 }
 
 extern bool is_stack_empty( void )
 {
-    return IS_STACK_EMPTY();
+    return IS_STACK_EMPTY( get_stack_state( ) );
 }
 
 /*
-   push returns new stack index [0..N[ for storing states. It asserts in
-   case of overflow . Note that overflow can only happen if a low water
-   mark is specified. If the stack is properly sized this should never happen.
+   push returns the new stack index for storing states.
 */
 extern stack_index_t push( void )
 {
-    SUDOKU_ASSERT( STACK_IS_OK() );
-
-    stack_pointer = stack_pointer + 1;
-    if ( IS_STACK_FULL() ) {
-        SUDOKU_ASSERT( 0 == low_water_mark || low_water_mark > bottom_stack );
-        bottom_stack ++;
-    }
-    SUDOKU_ASSERT( STACK_IS_OK() );
-    return STACK_INDEX(stack_pointer);
+    stack_state_t *stack = get_stack_state( );
+    SUDOKU_ASSERT( STACK_IS_OK(stack) );
+
+    stack->stack_pointer = stack->stack_pointer + 1;
+    return STACK_INDEX(stack->stack_pointer);
 }
 
 /*
-   pop returns previous stack index [0..N[ if it was in stack, or -1 in
+   pop returns previous stack index if it was in stack, or -1 in
    case of underflow
 */
 extern stack_index_t pop( void )
 {
-    SUDOKU_ASSERT( STACK_IS_OK() );
-    if ( IS_STACK_EMPTY() ) { return -1; }
+    stack_state_t *stack = get_stack_state( );
+    SUDOKU_ASSERT( STACK_IS_OK(stack) );
+    if ( IS_STACK_EMPTY(stack) ) { return -1; }
 
-    stack_pointer = stack_pointer - 1;
-    SUDOKU_ASSERT( STACK_IS_OK() );
-    return STACK_INDEX(stack_pointer);
+    stack->stack_pointer = stack->stack_pointer - 1;
+    SUDOKU_ASSERT( STACK_IS_OK(stack) );
+    return STACK_INDEX(stack->stack_pointer);
 }
 
 /*
@@ -129,17 +105,11 @@ extern stack_index_t pop( void )
 */
 extern stack_index_t pushn( unsigned int nb )
 {
-    SUDOKU_ASSERT( STACK_IS_OK() );
-
-    stack_pointer_t nsp = stack_pointer + nb;
-    if ( STACK_INDEX( stack_pointer ) < STACK_INDEX( bottom_stack ) &&
-         STACK_INDEX( nsp ) >= STACK_INDEX( bottom_stack ) ) {
-        unsigned int nbs = nsp + 1;
-        SUDOKU_ASSERT( 0 == low_water_mark || low_water_mark > nbs );
-        bottom_stack = nbs;
-    }
-    stack_pointer = nsp;
-    return STACK_INDEX(stack_pointer);
+    stack_state_t *stack = get_stack_state( );
+    SUDOKU_ASSERT( STACK_IS_OK(stack) );
+
+    stack->stack_pointer = stack->stack_pointer + nb;
+    return STACK_INDEX(stack->stack_pointer);
 }
 
 /*
@@ -148,20 +118,21 @@ extern stack_index_t pushn( unsigned int nb )
 */
 extern stack_pointer_t get_sp( void )
 {
-    return STACK_INDEX(stack_pointer);
+    return get_stack_state( )->stack_pointer;
 }
 
 extern stack_index_t set_sp( stack_pointer_t sp )
 {
-    SUDOKU_ASSERT( ( sp > bottom_stack ) && 
-                   ( 0 == low_water_mark || sp >= low_water_mark ) );
-    stack_pointer = sp;
-    return STACK_INDEX(stack_pointer);
+    stack_state_t *stack = get_stack_state( );
+    SUDOKU_ASSERT( ( sp > stack->bottom_stack ) && 
+                   ( 0 == stack->low_water_mark || sp >= stack->low_water_mark ) );
+    stack->stack_pointer = sp;
+    return STACK_INDEX(stack->stack_pointer);
 }
 
 extern stack_index_t get_current_stack_index( void )
 {
-    return STACK_INDEX(stack_pointer);
+    return STACK_INDEX(get_stack_state( )->stack_pointer);
 }
 
 extern stack_index_t get_stack_index( stack_pointer_t sp )
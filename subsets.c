@@ -65,9 +65,9 @@ static int get_symbols( locate_t by, int ref, int *symbols )
     for ( int index = 0; index < SUDOKU_N_SYMBOLS; ++index ) {
         cell_ref_t cr;
         get_cell_ref_in_set( by, ref, index, &cr );
-        sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-        if ( cell->n_symbols > 1 ) {
-            symbol_map |= cell->symbol_map;
+        grid_cell_t cell = get_cell( cr.row, cr.col );
+        if ( get_cell_n_symbols( cell ) > 1 ) {
+            symbol_map |= get_cell_map( cell );
         }
     }
 
@@ -96,17 +96,17 @@ static int get_cells_for_pair_map( locate_t by, int ref, int symbol_map, subset_
     for ( int index = 0; index < SUDOKU_N_SYMBOLS; ++index ) {
         cell_ref_t cr;
         get_cell_ref_in_set( by, ref, index, &cr );
-        sudoku_cell_t *cell = get_cell( cr.row, cr.col );
-        if ( 1 < cell->n_symbols ) {
-            if ( symbol_map == ( symbol_map & cell->symbol_map ) ) {
+        grid_cell_t cell = get_cell( cr.row, cr.col );
+        if ( 1 < get_cell_n_symbols( cell ) ) {
+            if ( symbol_map == ( symbol_map & get_cell_map( cell ) ) ) {
                 crs[n_cells].cr = cr;
                 crs[n_cells].n_matching = 2; // symbol_map fully included
-                crs[n_cells].n_extra = cell->n_symbols - 2;
+                crs[n_cells].n_extra = get_cell_n_symbols( cell ) - 2;
                 ++n_cells;
-            } else if ( symbol_map & cell->symbol_map ) {
+            } else if ( symbol_map & get_cell_map( cell ) ) {
                 partial_refs[*n_partial].cr = cr;
                 partial_refs[*n_partial].n_matching = 1;
-                partial_refs[*n_partial].n_extra = cell->n_symbols - 1;
+                partial_refs[*n_partial].n_extra = get_cell_n_symbols( cell ) - 1;
                 ++ *n_partial;
             }
         }
@@ -212,35 +212,35 @@ static bool get_cells_for_triplet_map( locate_t by, int ref, int max_map, int *m
     for ( int index = 0; index < SUDOKU_N_SYMBOLS; ++index ) {  // index in subset( by, ref )
         cell_ref_t cr;
         get_cell_ref_in_set( by, ref, index, &cr );
-        sudoku_cell_t *cell = get_cell( cr.row, cr.col );
+        grid_cell_t cell = get_cell( cr.row, cr.col );
 
-        if ( 1 < cell->n_symbols ) {
-            if ( max_map == ( max_map & cell->symbol_map ) ) {  // triplet symbols are included
+        if ( 1 < get_cell_n_symbols( cell ) ) {
+            if ( max_map == ( max_map & get_cell_map( cell ) ) ) {  // triplet symbols are included
                 crs[n_cells].cr = cr;
                 crs[n_cells].n_matching = 3;
-                crs[n_cells].n_extra = cell->n_symbols - 3;
+                crs[n_cells].n_extra = get_cell_n_symbols( cell ) - 3;
                 ++n_cells;
                 ++n_max;
             } else {
                 int n_triplet_symbols = 0;
                 int i = 0;
                 for ( ; i < 3; ++i ) {
-                    if ( min_maps[i] == ( min_maps[i] & cell->symbol_map ) ) {
+                    if ( min_maps[i] == ( min_maps[i] & get_cell_map( cell ) ) ) {
                         crs[n_cells].cr = cr;
                         crs[n_cells].n_matching = 2;
-                        crs[n_cells].n_extra = cell->n_symbols - 2;
+                        crs[n_cells].n_extra = get_cell_n_symbols( cell ) - 2;
                         ++n_cells;
                         ++n_min[i];
                         break;  // only 1 is possible since cell did not match max_map
 
-                    } else if ( min_maps[i] & cell->symbol_map ) {
+                    } else if ( min_maps[i] & get_cell_map( cell ) ) {
                         ++n_triplet_symbols;    // since min_maps have 2 symbols only, partial match is 1
                     }
                 }
                 if ( 3 == i && n_triplet_symbols ) {
                     partial_refs[*n_partial].cr = cr;
                     partial_refs[*n_partial].n_matching = n_triplet_symbols;
-                    partial_refs[*n_partial].n_extra = cell->n_symbols - n_triplet_symbols;
+                    partial_refs[*n_partial].n_extra = get_cell_n_symbols( cell ) - n_triplet_symbols;
                     ++ *n_partial;
                 }
             }
@@ -323,9 +323,11 @@ static int check_triplets( locate_t by, int ref, int n_symbols, int *symbols, hi
                 hdesc->symbol_map = max_map;
                 hdesc->hint_pencil = true;
 
-                hdesc->hints[hdesc->n_hints++] = crs[0].cr;
-                hdesc->hints[hdesc->n_hints++] = crs[1].cr;
-                hdesc->hints[hdesc->n_hints++] = crs[2].cr;
+                for ( int i = 0; i < 3; ++i ) {     // the naked triplet cells are trigger
+                    hdesc->triggers[hdesc->n_triggers] = crs[i].cr;
+                    hdesc->flavors[hdesc->n_triggers] = REGULAR_TRIGGER | PENCIL;
+                    ++hdesc->n_triggers;
+                }
                 int res = 0;
                 for ( int i = 0; i < n_partial; ++i ) {
                     hdesc->hints[hdesc->n_hints++] = prs[i].cr;
@@ -342,10 +344,12 @@ static int check_triplets( locate_t by, int ref, int n_symbols, int *symbols, hi
     return -1;
 }
 
-extern bool check_subsets( hint_desc_t *hdesc )
-/* return false if no subset or no candidate that can be removed,
-   or true if subset and some candidates can be removed. */
+extern int check_subsets( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+/* return 0 if no subset or no candidate that can be removed, or the number of
+   subsets allowing to remove some candidates, at most a pair and a triplet in
+   each row, col or box (see get_hints). */
 {
+    int n_hints = 0;
     for ( locate_t by = LOCATE_BY_ROW; by <= LOCATE_BY_BOX; ++by ) {
         for ( int ref = 0; ref < SUDOKU_N_SYMBOLS; ++ref ) { // ref = row, col or in box cell index
             int symbols[9];
@@ -353,13 +357,20 @@ extern bool check_subsets( hint_desc_t *hdesc )
             if ( n_symbols < 2 ) continue;
 
             int res = check_pairs( by, ref, n_symbols, symbols, hdesc );
-            if ( res != -1 ) return true;
+            if ( res != -1 ) {
+                ++n_hints;
+                if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+                n_symbols = get_symbols( by, ref, symbols ); // in case fct acted on hint
+                if ( n_symbols < 2 ) continue;
+            }
 
             res = check_triplets( by, ref, n_symbols, symbols, hdesc );
-            if ( res != -1 ) return true;
+            if ( res != -1 ) {
+                ++n_hints;
+                if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+            }
             // TODO: add quadruplets
         }
     }
-    return false;
+    return n_hints;
 }
-
@@ -1,4 +1,4 @@
 
 #include "hint.h"
 
-extern bool check_subsets( hint_desc_t *hdesc );
+extern int check_subsets( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt );
@@ -10,13 +10,14 @@
 #include <stdlib.h>
 #include <time.h>
 
+#include "session.h"
 #include "grid.h"
-#include "game.h"
 #include "solve.h"
 #include "hint.h"
 #include "debug.h"
 
 #include "files.h"
+#include "bank.h"
 #include "rand.h"
 
 /* Game states:
@@ -154,48 +155,56 @@ enum {
   SUDOKU_INIT, SUDOKU_ENTER, SUDOKU_STARTED, SUDOKU_OVER
 };
 
-static int sudoku_state = -1;
+_Thread_local sudoku_session_t *current_session;
+
+// make session current and return its UI context
+static const void *enter_session( sudoku_session_t *session )
+{
+    set_session( session );
+    return session->cntxt;
+}
 
 static void assert_game_state( int state, char *action )
 {
-    if ( state != sudoku_state ) {
+    if ( state != get_session()->state ) {
         printf( "%s: Inconsistent state %d (should be %d)\n",
-                action, sudoku_state, state );
+                action, get_session()->state, state );
         exit(1);
     }
 }
 
-static bool enter_game_valid = false;                   // initial value
-static bool show_conflict = true, auto_check = false;   // default values
-
-extern bool sudoku_is_game_on_going( void )
+extern bool sudoku_is_game_on_going( sudoku_session_t *session )
 {
-    return ( SUDOKU_STARTED == sudoku_state ) && is_undo_possible();
+    set_session( session );
+    return ( SUDOKU_STARTED == session->state ) && is_undo_possible();
 }
 
-extern bool sudoku_is_selection_possible( void )
+extern bool sudoku_is_selection_possible( sudoku_session_t *session )
 {
-  return ( SUDOKU_ENTER == sudoku_state ) || ( SUDOKU_STARTED == sudoku_state );
+    set_session( session );
+    return ( SUDOKU_ENTER == session->state ) || ( SUDOKU_STARTED == session->state );
 }
 
-extern bool sudoku_is_entering_game_on_going( void )
+extern bool sudoku_is_entering_game_on_going( sudoku_session_t *session )
 {
-    return (SUDOKU_ENTER == sudoku_state) && is_undo_possible();
+    set_session( session );
+    return (SUDOKU_ENTER == session->state) && is_undo_possible();
 }
 
-extern bool sudoku_is_entering_valid_game( void )
+extern bool sudoku_is_entering_valid_game( sudoku_session_t *session )
 {
-    return (SUDOKU_ENTER == sudoku_state) && enter_game_valid;
+    set_session( session );
+    return (SUDOKU_ENTER == session->state) && session->enter_game_valid;
 }
 
 static bool is_game_started( void )
 {
-    return SUDOKU_STARTED == sudoku_state;
+    return SUDOKU_STARTED == get_session()->state;
 }
 
 static bool is_game_on( void )
 {
-    return (SUDOKU_ENTER == sudoku_state) || (SUDOKU_STARTED == sudoku_state);
+    return (SUDOKU_ENTER == get_session()->state) || (SUDOKU_STARTED == get_session()->state);
 }
 /*
 static bool is_game_over( void )
@@ -205,28 +214,27 @@ static bool is_game_over( void )
 */
 static bool is_game_in_entering_state( void ) 
 {
-    return SUDOKU_ENTER == sudoku_state;
+    return SUDOKU_ENTER == get_session()->state;
 }
 
-static sudoku_ui_table_t sudoku_ui_fcts;
-#define SUDOKU_REDRAW( _c )                    sudoku_ui_fcts.redraw( _c )
-#define SUDOKU_SET_WINDOW_NAME( _c, _p )       sudoku_ui_fcts.set_window_name( _c, _p )
-#define SUDOKU_SET_STATUS( _c, _s, _v )        sudoku_ui_fcts.set_status( _c, _s, _v )
-#define SUDOKU_SET_BACK_LEVEL( _c, _l )        sudoku_ui_fcts.set_back_level( _c, _l )
-#define SUDOKU_SET_ENTER_MODE( _c, _m )        sudoku_ui_fcts.set_enter_mode( _c, _m )
-#define SUDOKU_ENABLE_MENU( _c, _m )           sudoku_ui_fcts.enable_menu( _c, _m )
-#define SUDOKU_DISABLE_MENU( _c, _m )          sudoku_ui_fcts.disable_menu( _c, _m )
-#define SUDOKU_ENABLE_MENU_ITEM( _c, _m, _i )  sudoku_ui_fcts.enable_menu_item( _c, _m, _i )
-#define SUDOKU_DISABLE_MENU_ITEM( _c, _m, _i ) sudoku_ui_fcts.disable_menu_item( _c, _m, _i )
-#define SUDOKU_SUCCESS_DIALOG( _c, _d )        sudoku_ui_fcts.success_dialog( _c, _d )
+#define SUDOKU_REDRAW( _c )                    get_session()->ui_fcts.redraw( _c )
+#define SUDOKU_SET_WINDOW_NAME( _c, _p )       get_session()->ui_fcts.set_window_name( _c, _p )
+#define SUDOKU_SET_STATUS( _c, _s, _v )        get_session()->ui_fcts.set_status( _c, _s, _v )
+#define SUDOKU_SET_BACK_LEVEL( _c, _l )        get_session()->ui_fcts.set_back_level( _c, _l )
+#define SUDOKU_SET_ENTER_MODE( _c, _m )        get_session()->ui_fcts.set_enter_mode( _c, _m )
+#define SUDOKU_ENABLE_MENU( _c, _m )           get_session()->ui_fcts.enable_menu( _c, _m )
+#define SUDOKU_DISABLE_MENU( _c, _m )          get_session()->ui_fcts.disable_menu( _c, _m )
+#define SUDOKU_ENABLE_MENU_ITEM( _c, _m, _i )  get_session()->ui_fcts.enable_menu_item( _c, _m, _i )
+#define SUDOKU_DISABLE_MENU_ITEM( _c, _m, _i ) get_session()->ui_fcts.disable_menu_item( _c, _m, _i )
+#define SUDOKU_SUCCESS_DIALOG( _c, _d )        get_session()->ui_fcts.success_dialog( _c, _d )
 
 static void set_game_state( const void *cntxt, int new_state )
 {
-    if ( new_state == sudoku_state ) return;
+    if ( new_state == get_session()->state ) return;
 
     switch (new_state) {
     case SUDOKU_INIT:
-        sudoku_state = SUDOKU_INIT;
+        get_session()->state = SUDOKU_INIT;
         printf("INIT state\n");
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_FILE_MENU);
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_EDIT_MENU );
@@ -242,7 +250,7 @@ static void set_game_state( const void *cntxt, int new_state )
         break;
 
     case SUDOKU_ENTER:
-        sudoku_state = SUDOKU_ENTER;
+        get_session()->state = SUDOKU_ENTER;
         printf("ENTER state\n");
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_FILE_MENU);
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_EDIT_MENU);
@@ -256,7 +264,7 @@ static void set_game_state( const void *cntxt, int new_state )
         break;
 
     case SUDOKU_STARTED:
-        sudoku_state = SUDOKU_STARTED;
+        get_session()->state = SUDOKU_STARTED;
         printf("GAME_STARTED state\n");
         SUDOKU_ENABLE_MENU( cntxt, SUDOKU_EDIT_MENU );
         SUDOKU_ENABLE_MENU( cntxt, SUDOKU_TOOL_MENU );
@@ -277,7 +285,7 @@ static void set_game_state( const void *cntxt, int new_state )
         break;
 
     case SUDOKU_OVER:
-        sudoku_state = SUDOKU_OVER;
+        get_session()->state = SUDOKU_OVER;
         printf("GAME_OVER state\n");
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_EDIT_MENU );
         SUDOKU_DISABLE_MENU( cntxt, SUDOKU_TOOL_MENU );
@@ -317,7 +325,7 @@ static void update_selection_dependent_menus( const void *cntxt )
 
 static void update_edit_menu( const void *cntxt )
 {
-    SUDOKU_ASSERT ( SUDOKU_STARTED == sudoku_state );
+    SUDOKU_ASSERT ( SUDOKU_STARTED == get_session()->state );
 
     if ( is_undo_possible( ) ) {
         SUDOKU_ENABLE_MENU_ITEM( cntxt, SUDOKU_EDIT_MENU, SUDOKU_UNDO_ITEM );
@@ -376,8 +384,9 @@ static void set_current_selection( const void *cntxt, int row, int col, bool for
     SUDOKU_REDRAW( cntxt );
 }
 
-extern void sudoku_set_selection( const void *cntxt, int row, int col )
+extern void sudoku_set_selection( sudoku_session_t *session, int row, int col )
 {
+    const void *cntxt = enter_session( session );
     set_current_selection( cntxt, row, col, false );
 }
 
@@ -387,8 +396,9 @@ static void remove_selection( const void *cntxt )
     update_selection_dependent_menus( cntxt );
 }
 
-extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
+extern void sudoku_move_selection( sudoku_session_t *session, sudoku_key_t how )
 {
+    set_session( session );
     int currentSelectedRow, newSelectedRow, currentSelectedCol, newSelectedCol;
  
     get_selected_row_col( &currentSelectedRow, &currentSelectedCol);
@@ -398,7 +408,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
     case SUDOKU_PAGE_UP:
         for ( newSelectedRow = 0; newSelectedRow < currentSelectedRow; newSelectedRow++ ) {
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
 	            return;
             }
         }
@@ -408,7 +418,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
         while ( newSelectedRow > 0 ) {
             newSelectedRow --;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -416,7 +426,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
     case SUDOKU_PAGE_DOWN:
         for ( newSelectedRow = SUDOKU_N_ROWS-1; newSelectedRow > currentSelectedRow; newSelectedRow-- ) {
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -425,7 +435,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
         while ( newSelectedRow < (SUDOKU_N_ROWS-1) ) {
             newSelectedRow ++;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -434,7 +444,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
         while (  newSelectedCol > 0 ) {
             newSelectedCol --;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -443,7 +453,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
         while ( newSelectedCol < (SUDOKU_N_COLS-1) ) {
             newSelectedCol ++;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -452,7 +462,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
         if ( newSelectedCol || newSelectedRow ) {
             newSelectedCol = newSelectedRow = 0;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow , newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow , newSelectedCol );
                 return;
             }
         }
@@ -462,7 +472,7 @@ extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how )
             newSelectedCol = SUDOKU_N_COLS-1;
             newSelectedRow = SUDOKU_N_ROWS-1;
             if ( ! is_cell_given( newSelectedRow, newSelectedCol ) ) {
-                sudoku_set_selection( cntxt, newSelectedRow, newSelectedCol );
+                sudoku_set_selection( session, newSelectedRow, newSelectedCol );
                 return;
             }
         }
@@ -489,14 +499,16 @@ static void start_new_game( const void *cntxt, const char *name )
 
 static char *get_game_name( int game_number )
 {
-    static char name_buffer[ 16 ];
+    static _Thread_local char name_buffer[ 16 ];
     sprintf( name_buffer, "s%d", game_number );
     return name_buffer;
 }
 
 static void do_game( const void *cntxt, int game_number )
 {
-    set_game_level( make_game( game_number ) );
+    int score;
+    set_game_level( make_game( game_number, &score ) );
+    set_game_score( score );
     start_new_game( cntxt, get_game_name( game_number ) );
 }
 
@@ -531,7 +543,7 @@ static char *get_level_string( sudoku_level_t level )
 static char *get_window_name_from_file_path( const char *file_path )
 {
 #define MAX_WINDOW_NAME 256
-    static char window_name[ MAX_WINDOW_NAME ];
+    static _Thread_local char window_name[ MAX_WINDOW_NAME ];
 
     const char *file_name = strrchr( file_path, PATH_SEPARATOR );
     if ( NULL == file_name ) file_name = file_path;
@@ -543,33 +555,68 @@ static char *get_window_name_from_file_path( const char *file_path )
     return window_name;
 }
 
-extern void sudoku_game_init( const void *cntxt, sudoku_ui_table_t *fcts )
+extern sudoku_session_t *sudoku_session_new( const void *cntxt, sudoku_ui_table_t *fcts )
 {
     SUDOKU_ASSERT( cntxt );
     SUDOKU_ASSERT( fcts );
 
-    sudoku_ui_fcts = *fcts;
-    SUDOKU_ASSERT( sudoku_ui_fcts.redraw );
-    SUDOKU_ASSERT( sudoku_ui_fcts.set_window_name );
-    SUDOKU_ASSERT( sudoku_ui_fcts.set_status );
-    SUDOKU_ASSERT( sudoku_ui_fcts.set_back_level );
-    SUDOKU_ASSERT( sudoku_ui_fcts.set_enter_mode );
-    SUDOKU_ASSERT( sudoku_ui_fcts.enable_menu );
-    SUDOKU_ASSERT( sudoku_ui_fcts.disable_menu );
-    SUDOKU_ASSERT( sudoku_ui_fcts.enable_menu_item );
-    SUDOKU_ASSERT( sudoku_ui_fcts.disable_menu_item );
-    SUDOKU_ASSERT( sudoku_ui_fcts.success_dialog );
-
+    sudoku_session_t *session = calloc( 1, sizeof(sudoku_session_t) );
+    if ( NULL == session ) return NULL;
+
+    session->cntxt = cntxt;
+    session->ui_fcts = *fcts;
+    SUDOKU_ASSERT( session->ui_fcts.redraw );
+    SUDOKU_ASSERT( session->ui_fcts.set_window_name );
+    SUDOKU_ASSERT( session->ui_fcts.set_status );
+    SUDOKU_ASSERT( session->ui_fcts.set_back_level );
+    SUDOKU_ASSERT( session->ui_fcts.set_enter_mode );
+    SUDOKU_ASSERT( session->ui_fcts.enable_menu );
+    SUDOKU_ASSERT( session->ui_fcts.disable_menu );
+    SUDOKU_ASSERT( session->ui_fcts.enable_menu_item );
+    SUDOKU_ASSERT( session->ui_fcts.disable_menu_item );
+    SUDOKU_ASSERT( session->ui_fcts.success_dialog );
+
+    session->state = -1;
+    session->show_conflict = true;
+
+    set_session( session );
     reset_game( );
     set_game_state( cntxt, SUDOKU_INIT );
 
     time_t initialized;
     time( &initialized );
-    set_random_seed ( (unsigned)initialized );
+    set_random_state_seed( &session->random, (uint64_t)initialized );
+    return session;
+}
+
+extern void sudoku_session_free( sudoku_session_t *session )
+{
+    if ( NULL == session ) return;
+
+    free_grid_stack( &session->grids );
+    free_solve_path( &session->path );
+    sudoku_solver_free( session->solver );
+    if ( current_session == session ) {
+        current_session = NULL;
+    }
+    free( session );
+}
+
+// errors are not saved in stack with grids: they must be updated after moving in stack
+static void update_errors_in_grid( void )
+{
+    int row, col;
+    get_selected_row_col( &row, &col );
+    if ( get_session()->show_conflict && -1 != row ) {
+        update_grid_errors( row, col );
+    } else {
+        reset_grid_errors( );
+    }
 }
 
-extern void sudoku_mark_state( const void *cntxt )
+extern void sudoku_mark_state( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     assert_game_state ( SUDOKU_STARTED, "sudoku_mark_state" );
 
@@ -583,8 +630,9 @@ extern void sudoku_mark_state( const void *cntxt )
     }
 }
 
-extern void sudoku_back_to_mark( const void *cntxt )
+extern void sudoku_back_to_mark( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     printf("Back to mark - calling return to last bookmark\n");
     assert_game_state ( SUDOKU_STARTED, "sudoku_back_to_mark" );
@@ -592,6 +640,7 @@ extern void sudoku_back_to_mark( const void *cntxt )
     printf("returned to mark %d\n", mark );
     if ( -1 != mark ) {
         reset_cell_attributes();
+        update_errors_in_grid( );
         printf("Setting new status and updating game\n");
         SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_BACK, mark  );
         SUDOKU_SET_BACK_LEVEL( cntxt, mark );
@@ -602,15 +651,25 @@ extern void sudoku_back_to_mark( const void *cntxt )
 
 static bool check_from_current_position( void )
 {
-    void *game = save_current_game_for_solving( );
-    bool res = find_one_solution( );
-    restore_saved_game( game );
+    bool res;
+    if ( get_cached_solvability( &res ) ) return res;
+
+    int known = check_game_solution( );     // no search if the game solution is known
+    if ( -1 != known ) {
+        res = known;
+    } else {
+        void *game = save_current_game_for_solving( );
+        res = find_one_solution( );
+        restore_saved_game( game );
+    }
+    set_cached_solvability( res );
     return res;
 }
 
 
-extern void sudoku_step( const void *cntxt )
+extern void sudoku_step( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_started() ) return;
 
@@ -626,7 +685,7 @@ extern void sudoku_step( const void *cntxt )
             set_game_state( cntxt, SUDOKU_OVER );
             SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_OVER, 0 );
         } else {
-            if ( show_conflict ) { reset_grid_errors( ); }
+            if ( session->show_conflict ) { reset_grid_errors( ); }
             SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_BLANK, 0 );
             update_edit_menu( cntxt );
         }
@@ -634,8 +693,9 @@ extern void sudoku_step( const void *cntxt )
     }
 }
 
-extern sudoku_hint_type sudoku_hint( const void *cntxt )
+extern sudoku_hint_type sudoku_hint( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_started( ) ) return NO_HINT;
 
@@ -657,8 +717,9 @@ extern sudoku_hint_type sudoku_hint( const void *cntxt )
     return hint;
 }
 
-extern void sudoku_fill( const void *cntxt, bool no_conflict )
+extern void sudoku_fill( sudoku_session_t *session, bool no_conflict )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
 
     if ( ! is_game_started( ) ) return;
@@ -673,8 +734,9 @@ extern void sudoku_fill( const void *cntxt, bool no_conflict )
     }
 }
 
-extern void sudoku_fill_all( const void *cntxt, bool no_conflict )
+extern void sudoku_fill_all( sudoku_session_t *session, bool no_conflict )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
 
     assert_game_state ( SUDOKU_STARTED, "sudoku_fill_all" );
@@ -695,8 +757,9 @@ extern void sudoku_fill_all( const void *cntxt, bool no_conflict )
     SUDOKU_REDRAW( cntxt );
 }
 
-extern void sudoku_check_from_current_position( const void *cntxt )
+extern void sudoku_check_from_current_position( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_started( ) ) return;
     reset_cell_attributes();
@@ -710,8 +773,9 @@ extern void sudoku_check_from_current_position( const void *cntxt )
     }
 }
 
-extern void sudoku_solve_from_current_position( const void *cntxt )
+extern void sudoku_solve_from_current_position( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_started( ) ) return;
 
@@ -737,22 +801,22 @@ static void update_entering_state( const void *cntxt )
     switch( check_current_grid( ) ) {
     case 2:
         SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_SEVERAL_SOLUTIONS, 0 );
-        if ( enter_game_valid ) {
-            enter_game_valid = false;
+        if ( get_session()->enter_game_valid ) {
+            get_session()->enter_game_valid = false;
             SUDOKU_SET_ENTER_MODE( cntxt, SUDOKU_CANCEL_GAME );
         }
         break;
     case 1:
         SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_ONE_SOLUTION_ONLY, 0 );
-        if ( ! enter_game_valid ) {
-            enter_game_valid = true;
+        if ( ! get_session()->enter_game_valid ) {
+            get_session()->enter_game_valid = true;
             SUDOKU_SET_ENTER_MODE( cntxt, SUDOKU_COMMIT_GAME );
         }
         break;
     case 0:
         SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_NO_SOLUTION, 0 );
-        if ( enter_game_valid ) {
-            enter_game_valid = false;
+        if ( get_session()->enter_game_valid ) {
+            get_session()->enter_game_valid = false;
             SUDOKU_SET_ENTER_MODE( cntxt, SUDOKU_CANCEL_GAME );
         }
         break;
@@ -778,9 +842,10 @@ static void get_paying_duration( sudoku_duration_t *dhms )
     dhms->seconds = duration;
 }
 
-extern bool sudoku_how_long_playing( sudoku_duration_t *duration_hms )
+extern bool sudoku_how_long_playing( sudoku_session_t *session, sudoku_duration_t *duration_hms )
 {
-    if ( SUDOKU_STARTED == sudoku_state ) {
+    set_session( session );
+    if ( SUDOKU_STARTED == session->state ) {
         get_paying_duration( duration_hms );
         return true;
     }
@@ -789,7 +854,7 @@ extern bool sudoku_how_long_playing( sudoku_duration_t *duration_hms )
 
 static void end_game( const void *cntxt )
 {
-    SUDOKU_ASSERT ( SUDOKU_STARTED == sudoku_state );
+    SUDOKU_ASSERT ( SUDOKU_STARTED == get_session()->state );
     sudoku_duration_t duration_hms;
     get_paying_duration( &duration_hms );
     printf( "         in %d hours, %d min, %d sec\n",
@@ -812,7 +877,7 @@ static bool toggle_symbol( const void *cntxt, int symbol, int row, int col )
         SUDOKU_REDRAW( cntxt );
     } else if ( is_game_started( ) ){
         game_toggle_cell_candidate( row, col, symbol-'1' );
-        if ( show_conflict ) { update_grid_errors( row, col ); }
+        if ( get_session()->show_conflict ) { update_grid_errors( row, col ); }
         update_edit_menu( cntxt );
         SUDOKU_REDRAW( cntxt );
 
@@ -820,16 +885,17 @@ static bool toggle_symbol( const void *cntxt, int symbol, int row, int col )
             SUDOKU_TRACE( SUDOKU_INTERFACE_DEBUG, ("SOLVED!\n") );
             return true;
         }
-        if ( auto_check ) {
-            sudoku_check_from_current_position( cntxt );
+        if ( get_session()->auto_check ) {
+            sudoku_check_from_current_position( get_session() );
         }
     }
 
     return false;
 }
 
-extern void sudoku_enter_symbol( const void *cntxt, int symbol )
+extern void sudoku_enter_symbol( sudoku_session_t *session, int symbol )
 {
+    const void *cntxt = enter_session( session );
     int row, col;
     get_selected_row_col( &row, &col );
     if ( -1 == row || -1 == col ) return;
@@ -849,8 +915,9 @@ static void empty_game( const void *cntxt )
     SUDOKU_REDRAW( cntxt );
 }
 
-extern void sudoku_toggle_entering_new_game( const void *cntxt )
+extern void sudoku_toggle_entering_new_game( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     if ( is_game_in_entering_state( ) ) {
         // cancel entering mode
         SUDOKU_SET_ENTER_MODE( cntxt, SUDOKU_ENTER_GAME );
@@ -863,12 +930,13 @@ extern void sudoku_toggle_entering_new_game( const void *cntxt )
     empty_game( cntxt );
 }
 
-extern int sudoku_toggle_conflict_detection( const void *cntxt  )
+extern int sudoku_toggle_conflict_detection( sudoku_session_t *session )
 {
-    bool res = show_conflict;
-    show_conflict = ! res;
+    const void *cntxt = enter_session( session );
+    bool res = session->show_conflict;
+    session->show_conflict = ! res;
     if ( is_game_on() ) {
-        if ( show_conflict ) {
+        if ( session->show_conflict ) {
             int col, row;
             get_selected_row_col( &row, &col );
             update_grid_errors( row, col );
@@ -880,13 +948,14 @@ extern int sudoku_toggle_conflict_detection( const void *cntxt  )
     return res;
 }
 
-extern int sudoku_toggle_auto_checking( const void *cntxt )
+extern int sudoku_toggle_auto_checking( sudoku_session_t *session )
 {
-    bool res = auto_check;
-    auto_check = ! res;
+    const void *cntxt = enter_session( session );
+    bool res = session->auto_check;
+    session->auto_check = ! res;
     if ( is_game_on() ) {
-        if ( auto_check ) {
-            sudoku_check_from_current_position( cntxt );
+        if ( session->auto_check ) {
+            sudoku_check_from_current_position( session );
         } else {
             SUDOKU_SET_STATUS( cntxt, SUDOKU_STATUS_BLANK, 0 );
         }
@@ -894,8 +963,9 @@ extern int sudoku_toggle_auto_checking( const void *cntxt )
     return res;
 }
 
-extern void sudoku_erase_selection( const void *cntxt )
+extern void sudoku_erase_selection( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
 
     int row, col;
@@ -916,11 +986,14 @@ extern void sudoku_erase_selection( const void *cntxt )
     }
 }
 
-extern void sudoku_commit_game( const void *cntxt, const char *game_name )
+extern void sudoku_commit_game( sudoku_session_t *session, const char *game_name )
 {
-    SUDOKU_ASSERT ( SUDOKU_ENTER == sudoku_state );
+    const void *cntxt = enter_session( session );
+    SUDOKU_ASSERT ( SUDOKU_ENTER == session->state );
 
     make_cells_given();
+    set_game_puzzle_from_givens( );
+    rate_game_puzzle( );
     SUDOKU_SET_ENTER_MODE( cntxt, SUDOKU_ENTER_GAME );
     SUDOKU_SET_WINDOW_NAME( cntxt, game_name );
     SUDOKU_SET_BACK_LEVEL( cntxt, 0 );
@@ -930,8 +1003,9 @@ extern void sudoku_commit_game( const void *cntxt, const char *game_name )
     SUDOKU_REDRAW( cntxt );
 }
 
-extern sudoku_level_t sudoku_pick_game( const void *cntxt, const char *number_string )
+extern sudoku_level_t sudoku_pick_game( sudoku_session_t *session, const char *number_string )
 {
+    const void *cntxt = enter_session( session );
     if ( number_string ) {
         int game_number = parse_game_number( number_string );
         if ( -1 != game_number ) {
@@ -942,18 +1016,33 @@ extern sudoku_level_t sudoku_pick_game( const void *cntxt, const char *number_st
     return 0;
 }
 
-extern sudoku_level_t sudoku_random_game( const void *cntxt )
+extern int sudoku_get_game_score( sudoku_session_t *session )
+{
+    set_session( session );
+    return get_game_score( );
+}
+
+extern int sudoku_get_game_number_by_score( int min_score )
+{
+    return get_bank_game_by_score( min_score );
+}
+
+extern sudoku_level_t sudoku_random_game( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     /* randomly choose a game number */
-    int nb = random_value( SUDOKU_MIN_GAME_NUMBER, SUDOKU_MAX_GAME_NUMBER );
+    int nb = random_state_value( &session->random, SUDOKU_MIN_GAME_NUMBER,
+                                                     SUDOKU_MAX_GAME_NUMBER );
     do_game( cntxt, nb );
     return get_game_level( );
 }
 
-extern sudoku_level_t sudoku_open_file( const void *cntxt, const char *path )
+extern sudoku_level_t sudoku_open_file( sudoku_session_t *session, const char *path )
 {
+    const void *cntxt = enter_session( session );
     void *game = save_current_game( );  // in case load file fails
     if ( load_file( path ) ) {
+        set_game_puzzle_from_givens( );
         const char *name = get_window_name_from_file_path( path );
         start_new_game( cntxt, name );  // discards saved game & start new one
         return get_game_level( );
@@ -962,8 +1051,9 @@ extern sudoku_level_t sudoku_open_file( const void *cntxt, const char *path )
     return 0;
 }
 
-extern void sudoku_undo( const void *cntxt )
+extern void sudoku_undo( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_on( ) ) return;
 
@@ -980,6 +1070,7 @@ extern void sudoku_undo( const void *cntxt )
             SUDOKU_SET_BACK_LEVEL( cntxt, get_bookmark_number( ) );
         }
         reset_cell_attributes();
+        update_errors_in_grid( );
         update_edit_menu( cntxt );
         SUDOKU_REDRAW( cntxt );
     } else {
@@ -987,8 +1078,9 @@ extern void sudoku_undo( const void *cntxt )
     }
 }
 
-extern void sudoku_redo( const void *cntxt )
+extern void sudoku_redo( sudoku_session_t *session )
 {
+    const void *cntxt = enter_session( session );
     SUDOKU_ASSERT( cntxt );
     if ( ! is_game_on( ) ) return;
 
@@ -1005,6 +1097,7 @@ extern void sudoku_redo( const void *cntxt )
             SUDOKU_SET_BACK_LEVEL( cntxt, get_bookmark_number( ) );
         }
         reset_cell_attributes();
+        update_errors_in_grid( );
         update_edit_menu( cntxt );
         SUDOKU_REDRAW( cntxt );
     } else {
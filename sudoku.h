@@ -6,6 +6,7 @@
 #ifndef __SUDOKU_H__
 #define __SUDOKU_H__
 
+#include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -20,8 +21,14 @@
     The frontend implements the main entry point, implements an event loop,
     and calls the package for executing the game and changing the game state.
 
-    Backend functions should be called from a single thread as internal data
-    structures are not protected against concurrent modifications.
+    All the state of a game is kept in a session (see @ref sudoku_session_t),
+    so that games in different sessions can be played from different threads
+    at the same time. A session is not protected against concurrent changes,
+    and it must be used by only one thread at a time. The standalone solver,
+    the batch solvers, puzzle rating (@ref sudoku_rate_puzzle) and puzzle
+    factories (see @ref solver) do not use any session and they can be used
+    from any number of threads at the same time, each solver context or
+    factory by one thread at a time.
 
     The game package calls back some user Interface functions, for instance a
     redraw function for refreshing the game window, and provides helper
@@ -567,14 +574,19 @@
    called when the user interface is ready to initialize or start the game.
 
    At some point in its initialization the front end must call the function
-   @ref sudoku_game_init and pass a pointer to the array of functions it
-   provides for implementing the sudoku interface.
+   @ref sudoku_session_new and pass a pointer to the array of functions it
+   provides for implementing the sudoku interface. The session returned is
+   then passed to all other game functions.
+
+@ref solver
+   for functions solving grids independently of the current game. They do
+   not need any user interface and can be called from multiple threads.
 */
 
 /** @addtogroup interface
 
    The following functions must be provided by the window system and passed
-   to the game as an array with sudoku_game_init. They are called by the game
+   to the game as an array with sudoku_session_new. They are called by the game
    during user action processing.
    @{
 */
@@ -838,14 +850,29 @@ typedef struct {
 
 } sudoku_ui_table_t;
 
-/** sudoku_game_init
+/** sudoku_session_t
+    Opaque game session, created by @ref sudoku_session_new. A session holds all
+    the state of one game, so that several games can be played in the same
+    process. Different sessions can be used at the same time by different threads,
+    but a session must not be used by more than one thread at a time. */
+typedef struct sudoku_session sudoku_session_t;
+
+/** sudoku_session_new
+   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
+                         end and game backend
    @param[in] fcts       The interface function table.
-   @remark   This function initializes the game backend and provides a set of callbacks.
+   @remark   This function initializes a new game session and provides a set of callbacks.
              The interface function table gives the front-end callbacks that the back-end
-             uses to drive the user interface.
-             This must be called by the front end before creating the game window.
+             uses to drive the user interface, and cntxt is passed back to each of them.
+             This must be called by the front end before creating the game window. The
+             function returns the new session, or NULL if not enough memory is available.
 */
-extern void sudoku_game_init( const void *cntxt, sudoku_ui_table_t *fcts );
+extern sudoku_session_t *sudoku_session_new( const void *cntxt, sudoku_ui_table_t *fcts );
+
+/** sudoku_session_free
+   @param[in] session    The session to release, as returned by @ref sudoku_session_new.
+*/
+extern void sudoku_session_free( sudoku_session_t *session );
 
 /** @} */
 
@@ -857,6 +884,7 @@ extern void sudoku_game_init( const void *cntxt, sudoku_ui_table_t *fcts );
 */
 
 /** sudoku_is_game_on_going
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark  This function should be called from enter, open, pick, and new menu dialogs,
             in order to check if a game is already on going, and warn about loosing a
             started game (See @ref warning_start_stop).
@@ -864,16 +892,18 @@ extern void sudoku_game_init( const void *cntxt, sudoku_ui_table_t *fcts );
             symbols when a game is not started or not being manually entered (see @ref
             sudoku_is_selection_possible)
 */
-extern bool sudoku_is_game_on_going( void );
+extern bool sudoku_is_game_on_going( sudoku_session_t *session );
 
 /** sudoku_is_entering_game_on_going
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark This function should be called from enter, open, pick, and new menu dialogs,
            in order to check if a game is being entered, and warn about loosing that
            game (see @ref warning_stop_entering).
 */
-extern bool sudoku_is_entering_game_on_going( void );
+extern bool sudoku_is_entering_game_on_going( sudoku_session_t *session );
 
 /** sudoku_is_entering_valid_game
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark If the new entered game is ready to be validated, and the user selects
            the menu item enter/accept, then the user interface should display the
            enter game name dialog box and commit the new game. If on the contrary
@@ -882,21 +912,23 @@ extern bool sudoku_is_entering_game_on_going( void );
            interface should simply cancel by toggling the mode (see @ref
            sudoku_toggle_entering_new_game).
 */
-extern bool sudoku_is_entering_valid_game( void );
+extern bool sudoku_is_entering_valid_game( sudoku_session_t *session );
 
 /** sudoku_is_selection_possible
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark This is used by the user interface to check whether a selection is possible,
            that is when a game is in process of being created, ready or ongoing.
 */
-extern bool sudoku_is_selection_possible( void );
+extern bool sudoku_is_selection_possible( sudoku_session_t *session );
 
 /** sudoku_how_long_playing
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @param duration  The time already spent playing the current game.
    @remark This function returns true if the game was ongoing, and in that
     case it also gives the time elapsed playing the current game. It can be
     called at any time, when the user has selected to display the elapsed time.
 */
-extern bool sudoku_how_long_playing( sudoku_duration_t *duration );
+extern bool sudoku_how_long_playing( sudoku_session_t *session, sudoku_duration_t *duration );
 
 /** @} */
 
@@ -924,8 +956,7 @@ typedef enum { EASY = 1, SIMPLE, MODERATE, DIFFICULT } sudoku_level_t;
 #define SUDOKU_MAX_GAME_NUMBER 10000 /**< Max game number in game selection */
 
 /** sudoku_random_game
-   @param[in] cntxt         The graphic/UI context passed back an forth between UI front
-                            end and game backend
+   @param[in] session       The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as result of selecting the
              menu item File:New. It is the front-end responsibility to display first a
              confirmation menu (see @ref warning_start_stop) if a game is already ongoing
@@ -935,11 +966,10 @@ typedef enum { EASY = 1, SIMPLE, MODERATE, DIFFICULT } sudoku_level_t;
              always in the range [SUDOKU_MIN_GAME_NUMBER - SUDOKU_MAX_GAME_NUMBER], both
              included.
 */
-extern sudoku_level_t sudoku_random_game( const void *cntxt  );
+extern sudoku_level_t sudoku_random_game( sudoku_session_t *session );
 
 /** sudoku_pick_game
-   @param[in] cntxt         The graphic/UI context passed back an forth between UI front
-                            end and game backend
+   @param[in] session       The game session, as returned by @ref sudoku_session_new
    @param[in] number_string The number passed as an ASCII string.
    @remark   This function should be called by the front end as a result of selecting
              the menu item File:Pick. It is the front-end responsibility to display first
@@ -951,11 +981,28 @@ extern sudoku_level_t sudoku_random_game( const void *cntxt  );
              in the range [SUDOKU_MIN_GAME_NUMBER - SUDOKU_MAX_GAME_NUMBER]. As with
              sudoku_random_game, the game difficulty level is returned.
 */
-extern sudoku_level_t sudoku_pick_game( const void *cntxt, const char *number_string );
+extern sudoku_level_t sudoku_pick_game( sudoku_session_t *session, const char *number_string );
+
+/** sudoku_get_game_score
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
+   @remark   This function returns the difficulty score of the current game (see
+             @ref sudoku_hint_stats_t), or 0 if it is not known, for instance if a
+             game entered manually does not have a unique solution.
+*/
+extern int sudoku_get_game_score( sudoku_session_t *session );
+
+/** sudoku_get_game_number_by_score
+   @param[in] min_score     The minimum score of the game.
+   @remark   This function returns the number of the game with the lowest score at
+             least equal to min_score, which can be then passed to @ref sudoku_pick_game.
+             It allows picking a game slightly harder than the previous one, without
+             any generation, but it requires the game bank (see README). It returns -1
+             if the bank is not available or if no game is hard enough.
+*/
+extern int sudoku_get_game_number_by_score( int min_score );
 
 /** sudoku_open_file
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @param[in] path       The absolute file path name.
    @remark   This function should be called by the front end as a result of selecting
              the menu item File:Open. It is the front-end responsibility to display first
@@ -966,19 +1013,17 @@ extern sudoku_level_t sudoku_pick_game( const void *cntxt, const char *number_st
              recommended that sudoku games use the default .sdk extension, but any file
              name can be used. The game difficulty level is returned.
 */
-extern sudoku_level_t sudoku_open_file( const void *cntxt, const char *path );
+extern sudoku_level_t sudoku_open_file( sudoku_session_t *session, const char *path );
 
 /** sudoku_toggle_entering_new_game
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as result of selecting
              the menu item Enter your game/Cancel this game (depending on the current
              state set by the backend with @ref set_enter_mode_fct_t). */
-extern void sudoku_toggle_entering_new_game( const void *cntxt );
+extern void sudoku_toggle_entering_new_game( sudoku_session_t *session );
 
 /** sudoku_commit_game
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @param[in] game_name  The new game name.
    @remark   This function should be called by the front end as a result of selecting
              the menu item Accept this game (set by the game backend in place of
@@ -989,11 +1034,10 @@ extern void sudoku_toggle_entering_new_game( const void *cntxt );
              "Accept") allowing the used to accept or cancel that game. Once the user
 	         accepts the front-end should call this function.
 */
-extern void sudoku_commit_game( const void *cntxt, const char *game_name );
+extern void sudoku_commit_game( sudoku_session_t *session, const char *game_name );
 
 /** sudoku_save_file
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @param[in] path       The absolute game path name.
    @remark   This function should be called by the front end as a result of selecting
              the menu itemFile:Save. As for sudoku_file_open, it is expected that the
@@ -1001,46 +1045,41 @@ extern void sudoku_commit_game( const void *cntxt, const char *game_name );
              manager in order to select a game name and its location. If the file exists
              it is overwriten.
 */
-extern int sudoku_save_file( const void *cntxt, const char *path );
+extern int sudoku_save_file( sudoku_session_t *session, const char *path );
 
 /** sudoku_undo
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Edit:Undo. The function just undoes the last operation.
 */
-extern void sudoku_undo( const void *cntxt );
+extern void sudoku_undo( sudoku_session_t *session );
 
 
 /** sudoku_redo
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Edit:Redo. The function redoes what has just been undone.
 */
-extern void sudoku_redo( const void *cntxt );
+extern void sudoku_redo( sudoku_session_t *session );
 
 /** sudoku_erase_selection
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Edit:Erase. The function just erases the values at the current
              selection.
 */
-extern void sudoku_erase_selection( const void *cntxt );
+extern void sudoku_erase_selection( sudoku_session_t *session );
 
 /** sudoku_mark_state
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Edit:Mark. The function just marks the current state in order
              to return quickly to it if needed (see @ref sudoku_back_to_mark).
 */
-extern void sudoku_mark_state( const void *cntxt );
+extern void sudoku_mark_state( sudoku_session_t *session );
 
 /** sudoku_back_to_mark
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Edit:Back. The function just goes back quickly to the last marked
              state, as if the user had undone all operations in between. Note that
@@ -1049,21 +1088,19 @@ extern void sudoku_mark_state( const void *cntxt );
              and it will not be possible to return to it (unless the same state is marked
              again).
 */
-extern void sudoku_back_to_mark( const void *cntxt );
+extern void sudoku_back_to_mark( sudoku_session_t *session );
 
 /** sudoku_check_from_current_position
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark   This function should be called by the front end as a result of selecting
              the menu Tools:Check, The function just checks whether there is a solution
              from the current state. The solver takes in account all symbols already
              entered (including multiple symbols in a single square).
 */
-extern void sudoku_check_from_current_position( const void *cntxt );
+extern void sudoku_check_from_current_position( sudoku_session_t *session );
 
 /** sudoku_hint
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark  This function should be called by the front end as a result of selecting
             the menu Tools:Hint. The function just moves the selection to a square
             that can be found by simple logic (if any). Hint may fail if the grid is
@@ -1071,20 +1108,18 @@ extern void sudoku_check_from_current_position( const void *cntxt );
             The hint type is returned, which may be NO_HINT or NO_SOLUTION if not valid
             hint is found, or any valid hint type.
 */
-extern sudoku_hint_type sudoku_hint( const void *cntxt );
+extern sudoku_hint_type sudoku_hint( sudoku_session_t *session );
 
 /** sudoku_step
-   @param[in] cntxt      The graphic/UI context passed back an forth between UI front
-                         end and game backend.
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
    @remark  This function can be called to execute a single step in solving a game. It
             could be used for a demonstration, executing 1 step every few seconds, for
             example.
 */
-extern void sudoku_step( const void *cntxt );
+extern void sudoku_step( sudoku_session_t *session );
 
 /** sudoku_fill
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @param[in] no_conflict Indicates whether symbols conflicting with other squares
                           should be automatically removed when filling up the square.
    @remark  This function should be called by the front end as a result of selecting
@@ -1092,11 +1127,10 @@ extern void sudoku_step( const void *cntxt );
             selected cell with all symbols. The argument no_conflict can be used to
             remove automatically the symbols that would create conflict otherwise.
 */
-extern void sudoku_fill( const void *cntxt, bool no_conflict );
+extern void sudoku_fill( sudoku_session_t *session, bool no_conflict );
 
 /** sudoku_fill_all
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @param[in] no_conflict Indicates whether symbols conflicting with other squares
                           should be automatically removed when filling up the square.
    @remark  This function should be called by the front end as a result of selecting
@@ -1107,11 +1141,10 @@ extern void sudoku_fill( const void *cntxt, bool no_conflict );
             no_conflict is TRUE, then it may completley solve the game in extremely
             simple cases.
 */
-extern void sudoku_fill_all( const void *cntxt, bool no_conflict );
+extern void sudoku_fill_all( sudoku_session_t *session, bool no_conflict );
 
 /** sudoku_solve_from_current_position
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @remark  This function should be called by the front end as a result of selecting
             the menu Tools:Solve. The function just solves the game from the current
             state if possible. If the game has no solution this is indicated by a
@@ -1119,22 +1152,20 @@ extern void sudoku_fill_all( const void *cntxt, bool no_conflict );
             is shown. It is still possible to undo the action and go back to solving
             the game by hand.
 */
-extern void sudoku_solve_from_current_position( const void *cntxt );
+extern void sudoku_solve_from_current_position( sudoku_session_t *session );
 
 /** sudoku_toggle_conflict_detection
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @remark  This function should be called by the front end as a result of selecting
             the menu Tools:Conflict.  This is a check box. Conflict detection is on
             by default when the game is initialized. The function toggles conflict
             detection in the game. It returns the previous state before toggling the
             state.
 */
-extern int sudoku_toggle_conflict_detection( const void *cntxt );
+extern int sudoku_toggle_conflict_detection( sudoku_session_t *session );
 
 /** sudoku_toggle_auto_checking
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @remark  This function should be called by the front end as a result of selecting
             the menu Tools:AutoCheck. This is a check box. Auto checking (checking
             automatically after each move) is off by default when the game is initialized.
@@ -1142,7 +1173,7 @@ extern int sudoku_toggle_conflict_detection( const void *cntxt );
             previous state before toggling the state. If the game is on this will force
             a redraw.
 */
-extern int sudoku_toggle_auto_checking( const void *cntxt );
+extern int sudoku_toggle_auto_checking( sudoku_session_t *session );
 
 /** sudoku_key_t
     Codes indicating how to move the current selection */
@@ -1159,8 +1190,7 @@ typedef enum {
 } sudoku_key_t;
 
 /** sudoku_move_selection
-   @param[in] cntxt        The graphic/UI context passed back an forth between UI front
-                           end and game backend.
+   @param[in] session      The game session, as returned by @ref sudoku_session_new
    @param[in] how          Key entered, indicating how the selection should be moved
    @remark                 This is used by the user interface to inform the game that
                            the user wants to move the selection with a keypress.
@@ -1168,17 +1198,16 @@ typedef enum {
                            the function @ref sudoku_erase_selection should be called
                            instead.
 */
-extern void sudoku_move_selection( const void *cntxt, sudoku_key_t how );
+extern void sudoku_move_selection( sudoku_session_t *session, sudoku_key_t how );
 
 /** sudoku_set_selection
-   @param[in] cntxt        The graphic/UI context passed back an forth between UI front
-                           end and game backend.
+   @param[in] session      The game session, as returned by @ref sudoku_session_new
    @param[in] row          row in which a selection is made.
    @param[in] col          column in which a selection is made.
    @remark                 This is used by the user interface to inform the game that the
                            user selected a cell with a mouse click.
 */
-extern void sudoku_set_selection( const void *cntxt, int row, int col );
+extern void sudoku_set_selection( sudoku_session_t *session, int row, int col );
 
 #define SUDOKU_N_ROWS           9 /**< Rows are numbered from 0 to 8 */
 #define SUDOKU_N_COLS           9 /**< Columns are numbered from 0 to 8 */
@@ -1242,6 +1271,7 @@ typedef struct {
 #define SUDOKU_IS_CELL_ALTERNATE_TRIGGER( _s )  ((bool)((_s) & SUDOKU_ALTERNATE_TRIGGER))
 
 /** sudoku_get_cell_definition
+   @param[in]  session     The game session, as returned by @ref sudoku_session_new
    @param[in]  row         row of the cell that is requested.
    @param[in]  col         column of the cell that is requested.
    @param[out] cell        A pointer to a cell definition that the function should
@@ -1251,7 +1281,8 @@ typedef struct {
                            column is invalid, the function returns false, otherwise
                            it updates the cell definition and returns true.
 */
-extern bool sudoku_get_cell_definition( int row, int col, sudoku_cell_t *cell );
+extern bool sudoku_get_cell_definition( sudoku_session_t *session, int row, int col,
+                                        sudoku_cell_t *cell );
 
 /** sudoku_get_symbol
 
@@ -1261,8 +1292,7 @@ extern bool sudoku_get_cell_definition( int row, int col, sudoku_cell_t *cell );
 extern char sudoku_get_symbol( sudoku_cell_t *cell );
 
 /** sudoku_enter_symbol
-   @param[in] cntxt       The graphic/UI context passed back an forth between UI front
-                          end and game backend.
+   @param[in] session     The game session, as returned by @ref sudoku_session_new
    @param[in] symbol      The key ascii code of the symbol
    @remark                The 9 characters correspondings to symbols can be entered to
                           toggle that symbol in the current selection:
@@ -1303,7 +1333,182 @@ extern char sudoku_get_symbol( sudoku_cell_t *cell );
    'd', 'D' for Doing (solving) the game should call @ref sudoku_solve_from_current_position.
 
 */
-extern void sudoku_enter_symbol( const void *cntxt, int symbol );
+extern void sudoku_enter_symbol( sudoku_session_t *session, int symbol );
+
+/** @} */
+
+/** @addtogroup solver
+   The following functions solve grids given as plain values, without any
+   reference to the game being played. Each solver context owns all its data,
+   so that different threads can solve at the same time with their own solver.
+   @{
+*/
+
+#define SUDOKU_N_CELLS  (SUDOKU_N_ROWS * SUDOKU_N_COLS) /**< 81 cells in a grid */
+#define SUDOKU_EMPTY_CELL       0 /**< value of an empty cell in @ref sudoku_grid_t */
+
+/** sudoku_grid_t
+    A grid value: cells are stored row after row (cell index is row * SUDOKU_N_COLS + col),
+    each cell holding either a symbol from 1 to 9 or SUDOKU_EMPTY_CELL. */
+typedef struct {
+  int8_t  cells[SUDOKU_N_CELLS];  /**< symbol 1 to 9, or SUDOKU_EMPTY_CELL */
+} sudoku_grid_t;
+
+/** sudoku_solver_t
+    Opaque solver context, created by @ref sudoku_solver_new. */
+typedef struct sudoku_solver sudoku_solver_t;
+
+/** sudoku_engine_t
+    Solving algorithms that a solver can use. */
+typedef enum {
+    SUDOKU_DLX_ENGINE,          /**< Knuth's dancing links exact cover */
+    SUDOKU_BITBOARD_ENGINE      /**< candidate bitmasks with singles propagation */
+} sudoku_engine_t;
+
+/** sudoku_solver_new
+   @remark  This function allocates a new solver context and returns it, or NULL if not
+            enough memory is available. A solver context must not be used by more than
+            one thread at a time, but each thread can use its own context concurrently.
+   @remark  The new solver uses the default engine, which is the bitboard engine unless
+            the library was built with SUDOKU_DEFAULT_ENGINE defined otherwise.
+*/
+extern sudoku_solver_t *sudoku_solver_new( void );
+
+/** sudoku_solver_set_engine
+   @param[in] solver      The solver context.
+   @param[in] engine      The engine to use for the next solves with that context.
+   @remark  Both engines give the same number of solutions. When a puzzle has more
+            than one solution, they may not find the same one first.
+*/
+extern void sudoku_solver_set_engine( sudoku_solver_t *solver, sudoku_engine_t engine );
+
+/** sudoku_set_game_engine
+   @param[in] session    The game session, as returned by @ref sudoku_session_new
+   @param[in] engine      The engine used by the game itself, for checking or solving
+                          the current game and for generating new games.
+   @remark  Like all game functions, this must not be called for the same session
+            by different threads at the same time.
+*/
+extern void sudoku_set_game_engine( sudoku_session_t *session, sudoku_engine_t engine );
+
+/** sudoku_solver_free
+   @param[in] solver      The solver context to release, as returned by @ref sudoku_solver_new.
+*/
+extern void sudoku_solver_free( sudoku_solver_t *solver );
+
+/** sudoku_solver_solve
+   @param[in] solver      The solver context to use.
+   @param[in] puzzle      The grid to solve. Non-empty cells are taken as givens.
+   @param[in] n_solutions The maximum number of solutions to look for (at least 1).
+   @param[out] solution   A pointer to a grid that receives the first solution found, if
+                          any. It may be NULL if only the number of solutions is needed,
+                          and it may be the same grid as puzzle.
+   @remark  This function returns the number of solutions found, from 0 to n_solutions.
+            Calling it with n_solutions 2 tells whether the puzzle has no solution, a
+            single solution or more than one solution.
+*/
+extern int sudoku_solver_solve( sudoku_solver_t *solver, const sudoku_grid_t *puzzle,
+                                int n_solutions, sudoku_grid_t *solution );
+
+/** sudoku_solve_batch
+   @param[in] puzzles      An array of n_puzzles grids to solve.
+   @param[out] solutions   An array of n_puzzles grids receiving the solution of each
+                           puzzle, or NULL if only the number of solutions is needed. The
+                           grid corresponding to a puzzle without solution is left unchanged.
+   @param[out] n_solutions An array of n_puzzles numbers of solutions: 0 (no solution),
+                           1 (unique solution) or 2 (more than one solution).
+   @param[in] n_puzzles    The number of puzzles to solve.
+   @param[in] n_threads    The number of threads to use, or 0 for as many threads as
+                           online cores.
+   @remark  This function solves all puzzles in parallel, each thread having its own solver.
+            The work is initially split in equal parts, and threads that finish early take
+            over half of the remaining puzzles of the busiest thread. Nothing is allocated
+            per puzzle. The function returns when all puzzles are solved, or false if the
+            threads or solvers could not be created.
+*/
+extern bool sudoku_solve_batch( const sudoku_grid_t *puzzles, sudoku_grid_t *solutions,
+                                uint8_t *n_solutions, size_t n_puzzles, int n_threads );
+
+/** sudoku_solve_lane_batch
+   @param[in] puzzles      An array of n_puzzles grids to solve.
+   @param[out] solutions   An array of n_puzzles grids receiving the solutions, or NULL.
+   @param[out] n_solutions An array of n_puzzles numbers of solutions (0, 1 or 2).
+   @param[in] n_puzzles    The number of puzzles to solve.
+   @param[in] n_threads    The number of threads to use, or 0 for as many threads as
+                           online cores.
+   @remark  This function gives the same results as @ref sudoku_solve_batch, but it is
+            meant for throughput on large batches: each thread advances 16 puzzles at
+            once, one per SIMD lane, as long as singles can be propagated. Puzzles that
+            need guessing are then finished one at a time by the thread solver.
+*/
+extern bool sudoku_solve_lane_batch( const sudoku_grid_t *puzzles, sudoku_grid_t *solutions,
+                                     uint8_t *n_solutions, size_t n_puzzles, int n_threads );
+
+/** sudoku_hint_stats_t
+    The number of hints of each type needed to solve a puzzle, as returned by
+    @ref sudoku_rate_puzzle, and the resulting difficulty score.
+
+    The score is a finer rating than the level: it is 100 times the weight of the
+    hardest hint type needed (from 1 for naked singles to 18 for chains, and 20 if
+    hints were not enough to solve the puzzle), plus the sum of the weights of all
+    hints needed divided by 4, up to 99. It is at least 1, 0 meaning that the score
+    is not known. Puzzles can be sorted by score, and puzzles at the same level have
+    close scores.
+*/
+typedef struct {
+    int n_naked_singles, n_hidden_singles;
+    int n_locked_candidates;
+    int n_naked_subsets, n_hidden_subsets;
+    int n_fishes, n_xy_wings, n_chains;
+    int score;
+} sudoku_hint_stats_t;
+
+#define SUDOKU_MAX_SCORE    2099    /**< Max difficulty score */
+
+/** sudoku_rate_puzzle
+   @param[in] puzzle     The puzzle to rate, which must have a unique solution.
+   @param[out] stats     The number of hints of each type needed to solve the puzzle,
+                         or NULL if not needed.
+   @remark  This function returns the puzzle difficulty level, the same as when the
+            puzzle is given by @ref sudoku_pick_game. The puzzle is solved with the
+            game hints on a private grid: the game, if any, is not modified and this
+            function can be called from any number of threads at the same time.
+*/
+extern sudoku_level_t sudoku_rate_puzzle( const sudoku_grid_t *puzzle,
+                                          sudoku_hint_stats_t *stats );
+
+/** sudoku_factory_t
+    A factory delivers random puzzles of a requested level. It is opaque to the caller.
+*/
+typedef struct sudoku_factory sudoku_factory_t;
+
+/** sudoku_factory_new
+   @param[in] n_threads  The number of threads generating puzzles, or 0 for as many
+                         threads as online cores.
+   @param[in] seed       The seed of the first generating thread, the next threads and
+                         the following requests using the next seeds.
+   @remark  This function returns a new factory, or NULL if it cannot be allocated.
+*/
+extern sudoku_factory_t *sudoku_factory_new( int n_threads, unsigned int seed );
+
+/** sudoku_factory_free
+   @param[in] factory    The factory to free, which may be NULL.
+*/
+extern void sudoku_factory_free( sudoku_factory_t *factory );
+
+/** sudoku_factory_make
+   @param[in] factory    The factory returned by @ref sudoku_factory_new.
+   @param[in] level      The requested level.
+   @param[in] n_puzzles  The number of puzzles to make.
+   @param[out] puzzles   An array of n_puzzles grids receiving the puzzles.
+   @remark  This function returns the number of puzzles made, which is n_puzzles
+            unless threads cannot be started. Puzzles are generated and rated in
+            parallel. Puzzles rated at another level are kept by the factory for later
+            requests. The game, if any, is not modified. A factory must not be used by
+            more than one thread at a time, but different factories can.
+*/
+extern size_t sudoku_factory_make( sudoku_factory_t *factory, sudoku_level_t level,
+                                   size_t n_puzzles, sudoku_grid_t *puzzles );
 
 /** @} */
 #endif /* __SUDOKU_H__ */
@@ -0,0 +1,292 @@
+/*
+  Sudoku unit and peer tables
+*/
+
+#include "units.h"
+
+/*
+    The tables are constant and generated once for all: rows, columns and
+    boxes never change, so that there is nothing to compute at run time.
+*/
+
+const uint8_t unit_cells[SUDOKU_N_UNITS][SUDOKU_N_SYMBOLS] = {
+    {  0,  1,  2,  3,  4,  5,  6,  7,  8 },  // row 0
+    {  9, 10, 11, 12, 13, 14, 15, 16, 17 },  // row 1
+    { 18, 19, 20, 21, 22, 23, 24, 25, 26 },  // row 2
+    { 27, 28, 29, 30, 31, 32, 33, 34, 35 },  // row 3
+    { 36, 37, 38, 39, 40, 41, 42, 43, 44 },  // row 4
+    { 45, 46, 47, 48, 49, 50, 51, 52, 53 },  // row 5
+    { 54, 55, 56, 57, 58, 59, 60, 61, 62 },  // row 6
+    { 63, 64, 65, 66, 67, 68, 69, 70, 71 },  // row 7
+    { 72, 73, 74, 75, 76, 77, 78, 79, 80 },  // row 8
+    {  0,  9, 18, 27, 36, 45, 54, 63, 72 },  // col 0
+    {  1, 10, 19, 28, 37, 46, 55, 64, 73 },  // col 1
+    {  2, 11, 20, 29, 38, 47, 56, 65, 74 },  // col 2
+    {  3, 12, 21, 30, 39, 48, 57, 66, 75 },  // col 3
+    {  4, 13, 22, 31, 40, 49, 58, 67, 76 },  // col 4
+    {  5, 14, 23, 32, 41, 50, 59, 68, 77 },  // col 5
+    {  6, 15, 24, 33, 42, 51, 60, 69, 78 },  // col 6
+    {  7, 16, 25, 34, 43, 52, 61, 70, 79 },  // col 7
+    {  8, 17, 26, 35, 44, 53, 62, 71, 80 },  // col 8
+    {  0,  1,  2,  9, 10, 11, 18, 19, 20 },  // box 0
+    {  3,  4,  5, 12, 13, 14, 21, 22, 23 },  // box 1
+    {  6,  7,  8, 15, 16, 17, 24, 25, 26 },  // box 2
+    { 27, 28, 29, 36, 37, 38, 45, 46, 47 },  // box 3
+    { 30, 31, 32, 39, 40, 41, 48, 49, 50 },  // box 4
+    { 33, 34, 35, 42, 43, 44, 51, 52, 53 },  // box 5
+    { 54, 55, 56, 63, 64, 65, 72, 73, 74 },  // box 6
+    { 57, 58, 59, 66, 67, 68, 75, 76, 77 },  // box 7
+    { 60, 61, 62, 69, 70, 71, 78, 79, 80 }   // box 8
+};
+
+const uint8_t cell_units[SUDOKU_N_CELLS][3] = {
+    { 0, 0, 0 },  // cell 0
+    { 0, 1, 0 },  // cell 1
+    { 0, 2, 0 },  // cell 2
+    { 0, 3, 1 },  // cell 3
+    { 0, 4, 1 },  // cell 4
+    { 0, 5, 1 },  // cell 5
+    { 0, 6, 2 },  // cell 6
+    { 0, 7, 2 },  // cell 7
+    { 0, 8, 2 },  // cell 8
+    { 1, 0, 0 },  // cell 9
+    { 1, 1, 0 },  // cell 10
+    { 1, 2, 0 },  // cell 11
+    { 1, 3, 1 },  // cell 12
+    { 1, 4, 1 },  // cell 13
+    { 1, 5, 1 },  // cell 14
+    { 1, 6, 2 },  // cell 15
+    { 1, 7, 2 },  // cell 16
+    { 1, 8, 2 },  // cell 17
+    { 2, 0, 0 },  // cell 18
+    { 2, 1, 0 },  // cell 19
+    { 2, 2, 0 },  // cell 20
+    { 2, 3, 1 },  // cell 21
+    { 2, 4, 1 },  // cell 22
+    { 2, 5, 1 },  // cell 23
+    { 2, 6, 2 },  // cell 24
+    { 2, 7, 2 },  // cell 25
+    { 2, 8, 2 },  // cell 26
+    { 3, 0, 3 },  // cell 27
+    { 3, 1, 3 },  // cell 28
+    { 3, 2, 3 },  // cell 29
+    { 3, 3, 4 },  // cell 30
+    { 3, 4, 4 },  // cell 31
+    { 3, 5, 4 },  // cell 32
+    { 3, 6, 5 },  // cell 33
+    { 3, 7, 5 },  // cell 34
+    { 3, 8, 5 },  // cell 35
+    { 4, 0, 3 },  // cell 36
+    { 4, 1, 3 },  // cell 37
+    { 4, 2, 3 },  // cell 38
+    { 4, 3, 4 },  // cell 39
+    { 4, 4, 4 },  // cell 40
+    { 4, 5, 4 },  // cell 41
+    { 4, 6, 5 },  // cell 42
+    { 4, 7, 5 },  // cell 43
+    { 4, 8, 5 },  // cell 44
+    { 5, 0, 3 },  // cell 45
+    { 5, 1, 3 },  // cell 46
+    { 5, 2, 3 },  // cell 47
+    { 5, 3, 4 },  // cell 48
+    { 5, 4, 4 },  // cell 49
+    { 5, 5, 4 },  // cell 50
+    { 5, 6, 5 },  // cell 51
+    { 5, 7, 5 },  // cell 52
+    { 5, 8, 5 },  // cell 53
+    { 6, 0, 6 },  // cell 54
+    { 6, 1, 6 },  // cell 55
+    { 6, 2, 6 },  // cell 56
+    { 6, 3, 7 },  // cell 57
+    { 6, 4, 7 },  // cell 58
+    { 6, 5, 7 },  // cell 59
+    { 6, 6, 8 },  // cell 60
+    { 6, 7, 8 },  // cell 61
+    { 6, 8, 8 },  // cell 62
+    { 7, 0, 6 },  // cell 63
+    { 7, 1, 6 },  // cell 64
+    { 7, 2, 6 },  // cell 65
+    { 7, 3, 7 },  // cell 66
+    { 7, 4, 7 },  // cell 67
+    { 7, 5, 7 },  // cell 68
+    { 7, 6, 8 },  // cell 69
+    { 7, 7, 8 },  // cell 70
+    { 7, 8, 8 },  // cell 71
+    { 8, 0, 6 },  // cell 72
+    { 8, 1, 6 },  // cell 73
+    { 8, 2, 6 },  // cell 74
+    { 8, 3, 7 },  // cell 75
+    { 8, 4, 7 },  // cell 76
+    { 8, 5, 7 },  // cell 77
+    { 8, 6, 8 },  // cell 78
+    { 8, 7, 8 },  // cell 79
+    { 8, 8, 8 }   // cell 80
+};
+
+const uint8_t cell_unit_indexes[SUDOKU_N_CELLS][3] = {
+    { 0, 0, 0 },  // cell 0
+    { 1, 0, 1 },  // cell 1
+    { 2, 0, 2 },  // cell 2
+    { 3, 0, 0 },  // cell 3
+    { 4, 0, 1 },  // cell 4
+    { 5, 0, 2 },  // cell 5
+    { 6, 0, 0 },  // cell 6
+    { 7, 0, 1 },  // cell 7
+    { 8, 0, 2 },  // cell 8
+    { 0, 1, 3 },  // cell 9
+    { 1, 1, 4 },  // cell 10
+    { 2, 1, 5 },  // cell 11
+    { 3, 1, 3 },  // cell 12
+    { 4, 1, 4 },  // cell 13
+    { 5, 1, 5 },  // cell 14
+    { 6, 1, 3 },  // cell 15
+    { 7, 1, 4 },  // cell 16
+    { 8, 1, 5 },  // cell 17
+    { 0, 2, 6 },  // cell 18
+    { 1, 2, 7 },  // cell 19
+    { 2, 2, 8 },  // cell 20
+    { 3, 2, 6 },  // cell 21
+    { 4, 2, 7 },  // cell 22
+    { 5, 2, 8 },  // cell 23
+    { 6, 2, 6 },  // cell 24
+    { 7, 2, 7 },  // cell 25
+    { 8, 2, 8 },  // cell 26
+    { 0, 3, 0 },  // cell 27
+    { 1, 3, 1 },  // cell 28
+    { 2, 3, 2 },  // cell 29
+    { 3, 3, 0 },  // cell 30
+    { 4, 3, 1 },  // cell 31
+    { 5, 3, 2 },  // cell 32
+    { 6, 3, 0 },  // cell 33
+    { 7, 3, 1 },  // cell 34
+    { 8, 3, 2 },  // cell 35
+    { 0, 4, 3 },  // cell 36
+    { 1, 4, 4 },  // cell 37
+    { 2, 4, 5 },  // cell 38
+    { 3, 4, 3 },  // cell 39
+    { 4, 4, 4 },  // cell 40
+    { 5, 4, 5 },  // cell 41
+    { 6, 4, 3 },  // cell 42
+    { 7, 4, 4 },  // cell 43
+    { 8, 4, 5 },  // cell 44
+    { 0, 5, 6 },  // cell 45
+    { 1, 5, 7 },  // cell 46
+    { 2, 5, 8 },  // cell 47
+    { 3, 5, 6 },  // cell 48
+    { 4, 5, 7 },  // cell 49
+    { 5, 5, 8 },  // cell 50
+    { 6, 5, 6 },  // cell 51
+    { 7, 5, 7 },  // cell 52
+    { 8, 5, 8 },  // cell 53
+    { 0, 6, 0 },  // cell 54
+    { 1, 6, 1 },  // cell 55
+    { 2, 6, 2 },  // cell 56
+    { 3, 6, 0 },  // cell 57
+    { 4, 6, 1 },  // cell 58
+    { 5, 6, 2 },  // cell 59
+    { 6, 6, 0 },  // cell 60
+    { 7, 6, 1 },  // cell 61
+    { 8, 6, 2 },  // cell 62
+    { 0, 7, 3 },  // cell 63
+    { 1, 7, 4 },  // cell 64
+    { 2, 7, 5 },  // cell 65
+    { 3, 7, 3 },  // cell 66
+    { 4, 7, 4 },  // cell 67
+    { 5, 7, 5 },  // cell 68
+    { 6, 7, 3 },  // cell 69
+    { 7, 7, 4 },  // cell 70
+    { 8, 7, 5 },  // cell 71
+    { 0, 8, 6 },  // cell 72
+    { 1, 8, 7 },  // cell 73
+    { 2, 8, 8 },  // cell 74
+    { 3, 8, 6 },  // cell 75
+    { 4, 8, 7 },  // cell 76
+    { 5, 8, 8 },  // cell 77
+    { 6, 8, 6 },  // cell 78
+    { 7, 8, 7 },  // cell 79
+    { 8, 8, 8 }   // cell 80
+};
+
+const uint8_t cell_peers[SUDOKU_N_CELLS][SUDOKU_N_PEERS] = {
+    {  1,  2,  9, 10, 11, 18, 19, 20, 27, 36, 45, 54, 63, 72,  3,  4,  5,  6,  7,  8 },  // cell 0
+    {  0,  2,  9, 10, 11, 18, 19, 20, 28, 37, 46, 55, 64, 73,  3,  4,  5,  6,  7,  8 },  // cell 1
+    {  0,  1,  9, 10, 11, 18, 19, 20, 29, 38, 47, 56, 65, 74,  3,  4,  5,  6,  7,  8 },  // cell 2
+    {  4,  5, 12, 13, 14, 21, 22, 23, 30, 39, 48, 57, 66, 75,  0,  1,  2,  6,  7,  8 },  // cell 3
+    {  3,  5, 12, 13, 14, 21, 22, 23, 31, 40, 49, 58, 67, 76,  0,  1,  2,  6,  7,  8 },  // cell 4
+    {  3,  4, 12, 13, 14, 21, 22, 23, 32, 41, 50, 59, 68, 77,  0,  1,  2,  6,  7,  8 },  // cell 5
+    {  7,  8, 15, 16, 17, 24, 25, 26, 33, 42, 51, 60, 69, 78,  0,  1,  2,  3,  4,  5 },  // cell 6
+    {  6,  8, 15, 16, 17, 24, 25, 26, 34, 43, 52, 61, 70, 79,  0,  1,  2,  3,  4,  5 },  // cell 7
+    {  6,  7, 15, 16, 17, 24, 25, 26, 35, 44, 53, 62, 71, 80,  0,  1,  2,  3,  4,  5 },  // cell 8
+    {  0,  1,  2, 10, 11, 18, 19, 20, 27, 36, 45, 54, 63, 72, 12, 13, 14, 15, 16, 17 },  // cell 9
+    {  0,  1,  2,  9, 11, 18, 19, 20, 28, 37, 46, 55, 64, 73, 12, 13, 14, 15, 16, 17 },  // cell 10
+    {  0,  1,  2,  9, 10, 18, 19, 20, 29, 38, 47, 56, 65, 74, 12, 13, 14, 15, 16, 17 },  // cell 11
+    {  3,  4,  5, 13, 14, 21, 22, 23, 30, 39, 48, 57, 66, 75,  9, 10, 11, 15, 16, 17 },  // cell 12
+    {  3,  4,  5, 12, 14, 21, 22, 23, 31, 40, 49, 58, 67, 76,  9, 10, 11, 15, 16, 17 },  // cell 13
+    {  3,  4,  5, 12, 13, 21, 22, 23, 32, 41, 50, 59, 68, 77,  9, 10, 11, 15, 16, 17 },  // cell 14
+    {  6,  7,  8, 16, 17, 24, 25, 26, 33, 42, 51, 60, 69, 78,  9, 10, 11, 12, 13, 14 },  // cell 15
+    {  6,  7,  8, 15, 17, 24, 25, 26, 34, 43, 52, 61, 70, 79,  9, 10, 11, 12, 13, 14 },  // cell 16
+    {  6,  7,  8, 15, 16, 24, 25, 26, 35, 44, 53, 62, 71, 80,  9, 10, 11, 12, 13, 14 },  // cell 17
+    {  0,  1,  2,  9, 10, 11, 19, 20, 27, 36, 45, 54, 63, 72, 21, 22, 23, 24, 25, 26 },  // cell 18
+    {  0,  1,  2,  9, 10, 11, 18, 20, 28, 37, 46, 55, 64, 73, 21, 22, 23, 24, 25, 26 },  // cell 19
+    {  0,  1,  2,  9, 10, 11, 18, 19, 29, 38, 47, 56, 65, 74, 21, 22, 23, 24, 25, 26 },  // cell 20
+    {  3,  4,  5, 12, 13, 14, 22, 23, 30, 39, 48, 57, 66, 75, 18, 19, 20, 24, 25, 26 },  // cell 21
+    {  3,  4,  5, 12, 13, 14, 21, 23, 31, 40, 49, 58, 67, 76, 18, 19, 20, 24, 25, 26 },  // cell 22
+    {  3,  4,  5, 12, 13, 14, 21, 22, 32, 41, 50, 59, 68, 77, 18, 19, 20, 24, 25, 26 },  // cell 23
+    {  6,  7,  8, 15, 16, 17, 25, 26, 33, 42, 51, 60, 69, 78, 18, 19, 20, 21, 22, 23 },  // cell 24
+    {  6,  7,  8, 15, 16, 17, 24, 26, 34, 43, 52, 61, 70, 79, 18, 19, 20, 21, 22, 23 },  // cell 25
+    {  6,  7,  8, 15, 16, 17, 24, 25, 35, 44, 53, 62, 71, 80, 18, 19, 20, 21, 22, 23 },  // cell 26
+    { 28, 29, 36, 37, 38, 45, 46, 47,  0,  9, 18, 54, 63, 72, 30, 31, 32, 33, 34, 35 },  // cell 27
+    { 27, 29, 36, 37, 38, 45, 46, 47,  1, 10, 19, 55, 64, 73, 30, 31, 32, 33, 34, 35 },  // cell 28
+    { 27, 28, 36, 37, 38, 45, 46, 47,  2, 11, 20, 56, 65, 74, 30, 31, 32, 33, 34, 35 },  // cell 29
+    { 31, 32, 39, 40, 41, 48, 49, 50,  3, 12, 21, 57, 66, 75, 27, 28, 29, 33, 34, 35 },  // cell 30
+    { 30, 32, 39, 40, 41, 48, 49, 50,  4, 13, 22, 58, 67, 76, 27, 28, 29, 33, 34, 35 },  // cell 31
+    { 30, 31, 39, 40, 41, 48, 49, 50,  5, 14, 23, 59, 68, 77, 27, 28, 29, 33, 34, 35 },  // cell 32
+    { 34, 35, 42, 43, 44, 51, 52, 53,  6, 15, 24, 60, 69, 78, 27, 28, 29, 30, 31, 32 },  // cell 33
+    { 33, 35, 42, 43, 44, 51, 52, 53,  7, 16, 25, 61, 70, 79, 27, 28, 29, 30, 31, 32 },  // cell 34
+    { 33, 34, 42, 43, 44, 51, 52, 53,  8, 17, 26, 62, 71, 80, 27, 28, 29, 30, 31, 32 },  // cell 35
+    { 27, 28, 29, 37, 38, 45, 46, 47,  0,  9, 18, 54, 63, 72, 39, 40, 41, 42, 43, 44 },  // cell 36
+    { 27, 28, 29, 36, 38, 45, 46, 47,  1, 10, 19, 55, 64, 73, 39, 40, 41, 42, 43, 44 },  // cell 37
+    { 27, 28, 29, 36, 37, 45, 46, 47,  2, 11, 20, 56, 65, 74, 39, 40, 41, 42, 43, 44 },  // cell 38
+    { 30, 31, 32, 40, 41, 48, 49, 50,  3, 12, 21, 57, 66, 75, 36, 37, 38, 42, 43, 44 },  // cell 39
+    { 30, 31, 32, 39, 41, 48, 49, 50,  4, 13, 22, 58, 67, 76, 36, 37, 38, 42, 43, 44 },  // cell 40
+    { 30, 31, 32, 39, 40, 48, 49, 50,  5, 14, 23, 59, 68, 77, 36, 37, 38, 42, 43, 44 },  // cell 41
+    { 33, 34, 35, 43, 44, 51, 52, 53,  6, 15, 24, 60, 69, 78, 36, 37, 38, 39, 40, 41 },  // cell 42
+    { 33, 34, 35, 42, 44, 51, 52, 53,  7, 16, 25, 61, 70, 79, 36, 37, 38, 39, 40, 41 },  // cell 43
+    { 33, 34, 35, 42, 43, 51, 52, 53,  8, 17, 26, 62, 71, 80, 36, 37, 38, 39, 40, 41 },  // cell 44
+    { 27, 28, 29, 36, 37, 38, 46, 47,  0,  9, 18, 54, 63, 72, 48, 49, 50, 51, 52, 53 },  // cell 45
+    { 27, 28, 29, 36, 37, 38, 45, 47,  1, 10, 19, 55, 64, 73, 48, 49, 50, 51, 52, 53 },  // cell 46
+    { 27, 28, 29, 36, 37, 38, 45, 46,  2, 11, 20, 56, 65, 74, 48, 49, 50, 51, 52, 53 },  // cell 47
+    { 30, 31, 32, 39, 40, 41, 49, 50,  3, 12, 21, 57, 66, 75, 45, 46, 47, 51, 52, 53 },  // cell 48
+    { 30, 31, 32, 39, 40, 41, 48, 50,  4, 13, 22, 58, 67, 76, 45, 46, 47, 51, 52, 53 },  // cell 49
+    { 30, 31, 32, 39, 40, 41, 48, 49,  5, 14, 23, 59, 68, 77, 45, 46, 47, 51, 52, 53 },  // cell 50
+    { 33, 34, 35, 42, 43, 44, 52, 53,  6, 15, 24, 60, 69, 78, 45, 46, 47, 48, 49, 50 },  // cell 51
+    { 33, 34, 35, 42, 43, 44, 51, 53,  7, 16, 25, 61, 70, 79, 45, 46, 47, 48, 49, 50 },  // cell 52
+    { 33, 34, 35, 42, 43, 44, 51, 52,  8, 17, 26, 62, 71, 80, 45, 46, 47, 48, 49, 50 },  // cell 53
+    { 55, 56, 63, 64, 65, 72, 73, 74,  0,  9, 18, 27, 36, 45, 57, 58, 59, 60, 61, 62 },  // cell 54
+    { 54, 56, 63, 64, 65, 72, 73, 74,  1, 10, 19, 28, 37, 46, 57, 58, 59, 60, 61, 62 },  // cell 55
+    { 54, 55, 63, 64, 65, 72, 73, 74,  2, 11, 20, 29, 38, 47, 57, 58, 59, 60, 61, 62 },  // cell 56
+    { 58, 59, 66, 67, 68, 75, 76, 77,  3, 12, 21, 30, 39, 48, 54, 55, 56, 60, 61, 62 },  // cell 57
+    { 57, 59, 66, 67, 68, 75, 76, 77,  4, 13, 22, 31, 40, 49, 54, 55, 56, 60, 61, 62 },  // cell 58
+    { 57, 58, 66, 67, 68, 75, 76, 77,  5, 14, 23, 32, 41, 50, 54, 55, 56, 60, 61, 62 },  // cell 59
+    { 61, 62, 69, 70, 71, 78, 79, 80,  6, 15, 24, 33, 42, 51, 54, 55, 56, 57, 58, 59 },  // cell 60
+    { 60, 62, 69, 70, 71, 78, 79, 80,  7, 16, 25, 34, 43, 52, 54, 55, 56, 57, 58, 59 },  // cell 61
+    { 60, 61, 69, 70, 71, 78, 79, 80,  8, 17, 26, 35, 44, 53, 54, 55, 56, 57, 58, 59 },  // cell 62
+    { 54, 55, 56, 64, 65, 72, 73, 74,  0,  9, 18, 27, 36, 45, 66, 67, 68, 69, 70, 71 },  // cell 63
+    { 54, 55, 56, 63, 65, 72, 73, 74,  1, 10, 19, 28, 37, 46, 66, 67, 68, 69, 70, 71 },  // cell 64
+    { 54, 55, 56, 63, 64, 72, 73, 74,  2, 11, 20, 29, 38, 47, 66, 67, 68, 69, 70, 71 },  // cell 65
+    { 57, 58, 59, 67, 68, 75, 76, 77,  3, 12, 21, 30, 39, 48, 63, 64, 65, 69, 70, 71 },  // cell 66
+    { 57, 58, 59, 66, 68, 75, 76, 77,  4, 13, 22, 31, 40, 49, 63, 64, 65, 69, 70, 71 },  // cell 67
+    { 57, 58, 59, 66, 67, 75, 76, 77,  5, 14, 23, 32, 41, 50, 63, 64, 65, 69, 70, 71 },  // cell 68
+    { 60, 61, 62, 70, 71, 78, 79, 80,  6, 15, 24, 33, 42, 51, 63, 64, 65, 66, 67, 68 },  // cell 69
+    { 60, 61, 62, 69, 71, 78, 79, 80,  7, 16, 25, 34, 43, 52, 63, 64, 65, 66, 67, 68 },  // cell 70
+    { 60, 61, 62, 69, 70, 78, 79, 80,  8, 17, 26, 35, 44, 53, 63, 64, 65, 66, 67, 68 },  // cell 71
+    { 54, 55, 56, 63, 64, 65, 73, 74,  0,  9, 18, 27, 36, 45, 75, 76, 77, 78, 79, 80 },  // cell 72
+    { 54, 55, 56, 63, 64, 65, 72, 74,  1, 10, 19, 28, 37, 46, 75, 76, 77, 78, 79, 80 },  // cell 73
+    { 54, 55, 56, 63, 64, 65, 72, 73,  2, 11, 20, 29, 38, 47, 75, 76, 77, 78, 79, 80 },  // cell 74
+    { 57, 58, 59, 66, 67, 68, 76, 77,  3, 12, 21, 30, 39, 48, 72, 73, 74, 78, 79, 80 },  // cell 75
+    { 57, 58, 59, 66, 67, 68, 75, 77,  4, 13, 22, 31, 40, 49, 72, 73, 74, 78, 79, 80 },  // cell 76
+    { 57, 58, 59, 66, 67, 68, 75, 76,  5, 14, 23, 32, 41, 50, 72, 73, 74, 78, 79, 80 },  // cell 77
+    { 60, 61, 62, 69, 70, 71, 79, 80,  6, 15, 24, 33, 42, 51, 72, 73, 74, 75, 76, 77 },  // cell 78
+    { 60, 61, 62, 69, 70, 71, 78, 80,  7, 16, 25, 34, 43, 52, 72, 73, 74, 75, 76, 77 },  // cell 79
+    { 60, 61, 62, 69, 70, 71, 78, 79,  8, 17, 26, 35, 44, 53, 72, 73, 74, 75, 76, 77 }   // cell 80
+};
@@ -0,0 +1,50 @@
+/*
+  sudoku units.h
+
+  Suduku game: unit and peer tables
+*/
+
+#ifndef __UNITS_H__
+#define __UNITS_H__
+
+#include <stdint.h>
+#include "sudoku.h"
+
+/* Constant tables giving the cells of each unit (row, column or box), the units of
+   each cell and the 20 peers of each cell (other cells in the same row, column or
+   box), so that addressing cells in a unit or around a cell takes no arithmetic.
+
+   A cell is given by its index, row * SUDOKU_N_COLS + col. A unit is given by its
+   kind (0 for rows, 1 for columns and 2 for boxes, in locate_t order) and its
+   reference in that kind [0..8], that is unit = SUDOKU_N_SYMBOLS * kind + ref.
+   Cells are in row order in a unit: in a box, index 0 is the top left cell and
+   index 8 the bottom right cell. */
+
+#define SUDOKU_N_UNITS  27
+#define SUDOKU_N_PEERS  20
+
+typedef enum { UNIT_ROW, UNIT_COL, UNIT_BOX } unit_kind_t;
+
+// cell index of each cell in each unit
+extern const uint8_t unit_cells[SUDOKU_N_UNITS][SUDOKU_N_SYMBOLS];
+
+// row, col and box of each cell, indexed by unit_kind_t
+extern const uint8_t cell_units[SUDOKU_N_CELLS][3];
+
+// index of each cell in its row (col), in its col (row) and in its box, by unit_kind_t
+extern const uint8_t cell_unit_indexes[SUDOKU_N_CELLS][3];
+
+// peers of each cell: first the 8 other cells in its box, in box order, then the 6
+// cells in its column outside the box, from top to bottom, and finally the 6 cells
+// in its row outside the box, from left to right
+extern const uint8_t cell_peers[SUDOKU_N_CELLS][SUDOKU_N_PEERS];
+
+#define FIRST_COL_PEER  8       // first peer in column outside the box
+#define FIRST_ROW_PEER  14      // first peer in row outside the box
+
+static inline int get_unit_cell( unit_kind_t kind, int ref, int index )
+{
+    return unit_cells[SUDOKU_N_SYMBOLS * kind + ref][index];
+}
+
+#endif /* __UNITS_H__ */
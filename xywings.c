@@ -12,9 +12,9 @@
 
 static int get_common_symbol_mask( cell_ref_t *c0, cell_ref_t *c1 )
 {
-    sudoku_cell_t *cell_1 = get_cell( c0->row, c0->col );
-    sudoku_cell_t *cell_2 = get_cell( c1->row, c1->col );
-    return cell_1->symbol_map & cell_2->symbol_map;
+    grid_cell_t cell_1 = get_cell( c0->row, c0->col );
+    grid_cell_t cell_2 = get_cell( c1->row, c1->col );
+    return get_cell_map( cell_1 ) & get_cell_map( cell_2 );
 }
 
 typedef enum {
@@ -27,11 +27,11 @@ static xy_wing_geometry set_2_box_horizontal_hints( int b0_col, int b1_col, int
     bool single = false;
     int n_hints = 0;
     for ( int c = b1_col; c < b1_col + 3; ++c ) {
-        sudoku_cell_t *cell = get_cell( c1_row, c );
-        if ( 1 < cell->n_symbols && ( hdesc->symbol_map & cell->symbol_map ) ) {
+        grid_cell_t cell = get_cell( c1_row, c );
+        if ( 1 < get_cell_n_symbols( cell ) && ( hdesc->symbol_map & get_cell_map( cell ) ) ) {
             hdesc->hints[n_hints].row = c1_row;
             hdesc->hints[n_hints].col = c;
-            if ( ! single && 2 == cell->n_symbols ) {
+            if ( ! single && 2 == get_cell_n_symbols( cell ) ) {
                 hdesc->selection = hdesc->hints[n_hints];
                 single = true;
             }
@@ -41,11 +41,11 @@ static xy_wing_geometry set_2_box_horizontal_hints( int b0_col, int b1_col, int
     for ( int c = b0_col; c < b0_col + 3; ++c ) {
         if ( c == c0_col ) continue;
 
-        sudoku_cell_t *cell = get_cell( c0_row, c );
-        if ( 1 < cell->n_symbols && ( hdesc->symbol_map & cell->symbol_map ) ) {
+        grid_cell_t cell = get_cell( c0_row, c );
+        if ( 1 < get_cell_n_symbols( cell ) && ( hdesc->symbol_map & get_cell_map( cell ) ) ) {
             hdesc->hints[n_hints].row = c0_row;
             hdesc->hints[n_hints].col = c;
-            if ( ! single && 2 == cell->n_symbols ) {
+            if ( ! single && 2 == get_cell_n_symbols( cell ) ) {
                 hdesc->selection = hdesc->hints[n_hints];
                 single = true;
             }
@@ -66,11 +66,11 @@ static xy_wing_geometry set_2_box_vertical_hints( int b0_row, int b1_row, int c0
     bool single = false;
     int n_hints = 0;
     for ( int r = b1_row; r < b1_row + 3; ++r ) {
-        sudoku_cell_t *cell = get_cell( r, c1_col );
-        if ( 1 < cell->n_symbols && ( hdesc->symbol_map & cell->symbol_map ) ) {
+        grid_cell_t cell = get_cell( r, c1_col );
+        if ( 1 < get_cell_n_symbols( cell ) && ( hdesc->symbol_map & get_cell_map( cell ) ) ) {
             hdesc->hints[n_hints].row = r;
             hdesc->hints[n_hints].col = c1_col;
-            if ( ! single && 2 == cell->n_symbols ) {
+            if ( ! single && 2 == get_cell_n_symbols( cell ) ) {
                 hdesc->selection = hdesc->hints[n_hints];
                 single = true;
             }
@@ -80,11 +80,11 @@ static xy_wing_geometry set_2_box_vertical_hints( int b0_row, int b1_row, int c0
     for ( int r = b0_row; r < b0_row + 3; ++r ) {
         if ( r == c0_row ) continue;
 
-        sudoku_cell_t *cell = get_cell( r, c0_col );
-        if ( 1 < cell->n_symbols && ( hdesc->symbol_map & cell->symbol_map ) ) {
+        grid_cell_t cell = get_cell( r, c0_col );
+        if ( 1 < get_cell_n_symbols( cell ) && ( hdesc->symbol_map & get_cell_map( cell ) ) ) {
             hdesc->hints[n_hints].row = r;
             hdesc->hints[n_hints].col = c0_col;
-            if ( ! single && 2 == cell->n_symbols ) {
+            if ( ! single && 2 == get_cell_n_symbols( cell ) ) {
                 hdesc->selection = hdesc->hints[n_hints];
                 single = true;
             }
@@ -143,12 +143,12 @@ static xy_wing_geometry check_2_box_geometry( int box0, int box1, // box0 has 2
 static xy_wing_geometry set_3_box_hints( cell_ref_t *pair_a, cell_ref_t *pair_b, hint_desc_t *hdesc )
 {
     hdesc->symbol_map = get_common_symbol_mask( pair_a, pair_b );
-    sudoku_cell_t *cell = get_cell( pair_a->row, pair_b->col );
-    if ( 1 < cell->n_symbols && ( hdesc->symbol_map & cell->symbol_map ) ) {
+    grid_cell_t cell = get_cell( pair_a->row, pair_b->col );
+    if ( 1 < get_cell_n_symbols( cell ) && ( hdesc->symbol_map & get_cell_map( cell ) ) ) {
         hdesc->hints[0].row = pair_a->row;              // hint row from pair_a
         hdesc->hints[0].col = pair_b->col;              // hint col from pair_b
 
-        if ( 2 == cell->n_symbols ) hdesc->selection = hdesc->hints[0];
+        if ( 2 == get_cell_n_symbols( cell ) ) hdesc->selection = hdesc->hints[0];
 
         hdesc->n_hints = 1;
         hdesc->n_triggers = 3;
@@ -212,30 +212,17 @@ static xy_wing_geometry check_xy_wing_geometry( cell_ref_t *pairs, hint_desc_t *
 
 static void get_pair_symbols( int map, int *s0_mask, int *s1_mask )
 {
-    int n_symbols = 0;
-    for ( int i = 0; ; ++i ) {
-        if ( 0 == map ) break;
-        if ( map & 1 << i ) {
-            if ( n_symbols == 0 ) {
-                *s0_mask = 1 << i;
-                n_symbols = 1;
-            } else {
-                assert( map == 1 << i );
-                *s1_mask = 1 << i;
-                return;
-            }
-            map &= ~ ( 1 << i );
-        }
-    }
-    assert( 0 );
+    assert( 2 == get_n_bits_from_map( map ) );
+    *s0_mask = 1 << extract_bit_from_map( &map );
+    *s1_mask = map;
 }
 
 static xy_wing_geometry get_3rd_matching_pair( int symbol_map, int n_pairs, cell_ref_t *pairs,
                                                cell_ref_t *matching_pairs, hint_desc_t *hdesc )
 {
     for ( int j = 0; j < n_pairs; ++ j ) {
-        sudoku_cell_t *cell = get_cell( pairs[j].row, pairs[j].col );
-        if ( cell->symbol_map == symbol_map ) {
+        grid_cell_t cell = get_cell( pairs[j].row, pairs[j].col );
+        if ( get_cell_map( cell ) == symbol_map ) {
             matching_pairs[2] = pairs[j];
             xy_wing_geometry geometry = check_xy_wing_geometry( matching_pairs, hdesc );
             if ( NO_XY_WING != geometry ) return geometry;
@@ -247,14 +234,14 @@ static xy_wing_geometry get_3rd_matching_pair( int symbol_map, int n_pairs, cell
 static xy_wing_geometry search_for_xy_wing_in_matching_pairs( int n_pairs, cell_ref_t *pairs,
                                                               cell_ref_t *matching_pairs, hint_desc_t *hdesc )
 {
-    sudoku_cell_t *cell_0 = get_cell( matching_pairs[0].row, matching_pairs[0].col );
-    int symbol_map_0 = cell_0->symbol_map;                              // 2^s0 | 2^s1
+    grid_cell_t cell_0 = get_cell( matching_pairs[0].row, matching_pairs[0].col );
+    int symbol_map_0 = get_cell_map( cell_0 );                              // 2^s0 | 2^s1
     int s0_mask, s1_mask;
     get_pair_symbols( symbol_map_0, &s0_mask, &s1_mask );
 
     for ( int i = 0; i < n_pairs; ++i ) {
-        sudoku_cell_t *cell_1 = get_cell( pairs[i].row, pairs[i].col );
-        int map = cell_1->symbol_map;
+        grid_cell_t cell_1 = get_cell( pairs[i].row, pairs[i].col );
+        int map = get_cell_map( cell_1 );
         if ( map == symbol_map_0 ) continue;    // 2^s0 | 2^s1 : naked subset, try another pair
 
         xy_wing_geometry geo;
@@ -279,8 +266,8 @@ static int get_symbol_pairs( cell_ref_t *refs )
     int n_refs = 0;
     for ( int r = 0; r < SUDOKU_N_ROWS; ++r ) {
         for ( int c = 0; c < SUDOKU_N_COLS; ++c ) {
-            sudoku_cell_t *cell = get_cell( r, c );
-            if ( 2 == cell->n_symbols ) {
+            grid_cell_t cell = get_cell( r, c );
+            if ( 2 == get_cell_n_symbols( cell ) ) {
                 refs[n_refs].row = r;
                 refs[n_refs].col = c;
                 ++n_refs;
@@ -290,13 +277,26 @@ static int get_symbol_pairs( cell_ref_t *refs )
     return n_refs;
 }
 
-extern bool search_for_xy_wing( hint_desc_t *hdesc )
+// return the index of the first pair after cell cr, in pairs collected by get_symbol_pairs
+static int get_next_pair( int n_pairs, cell_ref_t *pairs, cell_ref_t *cr )
+{
+    int i = 0;
+    while ( i < n_pairs && ( pairs[i].row < cr->row ||
+                             ( pairs[i].row == cr->row && pairs[i].col <= cr->col ) ) ) {
+        ++i;
+    }
+    return i;
+}
+
+extern int search_for_xy_wing( hint_desc_t *hdesc, hint_fct_t fct, void *cntxt )
+// return 0 if no XY-wing, or the number of XY-wings found, at most one for each
+// pair of symbols taken as first pair (see get_hints).
 {
     cell_ref_t pairs[ SUDOKU_N_SYMBOLS * SUDOKU_N_SYMBOLS ]; // must be less than the complete grid
     int n_pairs = get_symbol_pairs( pairs );
-    if ( n_pairs < 3 ) return -1;
-
+    if ( n_pairs < 3 ) return 0;
 
+    int n_hints = 0;
     cell_ref_t matching_pairs[3];
     for ( int i = 0; i < n_pairs; ++i ) {
         matching_pairs[0] = pairs[i];
@@ -308,8 +308,11 @@ extern bool search_for_xy_wing( hint_desc_t *hdesc )
         hdesc->hint_pencil = true;
         hdesc->action = REMOVE;
         hdesc->n_symbols = 1;
-        return true;
+        ++n_hints;
+        if ( report_hint( hdesc, fct, cntxt ) ) return n_hints;
+
+        n_pairs = get_symbol_pairs( pairs );                // in case fct acted on hint
+        i = get_next_pair( n_pairs, pairs, &matching_pairs[0] ) - 1;
     }
-    return false;
+    return n_hints;
 }
-
@@ -0,0 +1,418 @@
+/*
+  Sudoku zobrist keys
+*/
+
+#include "zobrist.h"
+
+/*
+    The keys are constant, drawn once for all from a splitmix64 sequence, so
+    that a grid has the same hash in every session, thread and run.
+*/
+
+const grid_hash_t zobrist_keys[SUDOKU_N_CELLS][SUDOKU_N_SYMBOLS] = {
+    {  // cell 0
+      0xba139fd41630feedu, 0xd502c550f9b28200u, 0x373726758afa2ad8u,
+      0xc3ce3c833976ac15u, 0x51f6966800557127u, 0x36147c78832a5cb5u,
+      0x7fe4d0755a48b8b3u, 0x4cb438eee2386cf5u, 0xf20fb82a80c859c2u
+    },
+    {  // cell 1
+      0x5bbe2d37e767e2b6u, 0x2eb901403f6c1f0bu, 0x3e60273178406eb2u,
+      0x73ddbf1163f7ff3au, 0x2bab10ec2071788bu, 0x2c8e8c0e0a4ad5e4u,
+      0x7438ee93d63eaae3u, 0x3b1198ae2f65946eu, 0x623e668e8acf8007u
+    },
+    {  // cell 2
+      0x61cefb2a9da7ea10u, 0x0bfc0a01586e97f3u, 0x74a2fd1c76584bfdu,
+      0x7150757bd5ef34b8u, 0x84d061b512fd815cu, 0x1b37c6ac4c60d9d4u,
+      0xe5c8557437ab3399u, 0x96d832f8196f37beu, 0x992cc09b775cd392u
+    },
+    {  // cell 3
+      0x59c804130702c2dau, 0xb38f56d640d329fcu, 0xcae3d67a7c6ae219u,
+      0xce9c2ec17d68c3ccu, 0x9c9d0c0a3bcf2518u, 0xcf3e17d92e2cffffu,
+      0x21263c1f45807ce4u, 0x6413f4b4425ea924u, 0xefcf4bfed3aef0a0u
+    },
+    {  // cell 4
+      0x2d86a2d619b3ac5fu, 0x58f5e2b5275e7f22u, 0x2590ea6649e570eau,
+      0xf669e6d7bcc7cf82u, 0x60772f6930e0226fu, 0xb9241908263fe1d4u,
+      0xde3f728bf0809664u, 0xdf3721962b687662u, 0x62bef609442a01b7u
+    },
+    {  // cell 5
+      0xcc870467d6c9f2ceu, 0x0920e007e76b447eu, 0xd7fde90e1f131e77u,
+      0x30ffd46df276199eu, 0x6fceeb7b3ebb7bfau, 0x4abcb5fbb70ea668u,
+      0xd1f8bd37a21ea83fu, 0x8d170c89622ae5ccu, 0xc9e97a972dc7b52du
+    },
+    {  // cell 6
+      0x48a2b032473d040au, 0x429ad03fb4e4900bu, 0x6b6dddb90b3b74dbu,
+      0x60eeed8f38a09221u, 0x99e552a97ed58f7bu, 0xb706b4224e79b023u,
+      0x7f9da8cf2cc975d6u, 0xe2eafe0ec849d4d2u, 0x24ebd956a0edba00u
+    },
+    {  // cell 7
+      0x3217fc67d17670ccu, 0x11d1bc55b1cafcb6u, 0xd30f5a7fbe4a3227u,
+      0xc38a9fb76adef41au, 0xcfaa2eb8e95f2bbau, 0x59cb28b84db23ee0u,
+      0x6e17d41fd0d0fdf5u, 0x9da5bdae7b9f1089u, 0xfecfc0bf77baedd4u
+    },
+    {  // cell 8
+      0x9e31ea053b9cbe09u, 0x65c1a93540f99fd7u, 0x0f1c1dd436d5fa89u,
+      0xc1c2109788816a53u, 0xda543fa89fda4622u, 0xa674df71fa18e7e9u,
+      0xacd5eb50ea75f58au, 0x372836c70d2d6bacu, 0xe146886e0f929c6bu
+    },
+    {  // cell 9
+      0x4499b58eadea53dcu, 0x7903d5d9c528fc75u, 0x1e6b16acff570b08u,
+      0x119cc352d7987c40u, 0xa96b4e3669de712cu, 0xccff7174ad091445u,
+      0x6c23ba8f872b88e8u, 0xd0de90459a8428dau, 0x907994ba51603e54u
+    },
+    {  // cell 10
+      0x338ad0f49180845fu, 0xe3ac25199a546cb3u, 0x5851373e3eccc122u,
+      0x4435ba7ad6341750u, 0x8ba239aea437ff26u, 0x9c8cfe0ecf47ea37u,
+      0x842ea33d3c19e2f6u, 0x1e0ec0ba0aa596feu, 0x8161c495ac617033u
+    },
+    {  // cell 11
+      0xf4884e9500621104u, 0xf19bd9887e3dfc59u, 0x9117641a7b693523u,
+      0xd04584c7bae301dbu, 0xc86ecc3ca7035a67u, 0xfc2407068a1c6908u,
+      0x2c6c2758bf975928u, 0xbf6e0d9d8d635606u, 0xd71f78c93236d13du
+    },
+    {  // cell 12
+      0xf5da537d180b000bu, 0x1cc19162586f4fa9u, 0x48adcba82c777412u,
+      0xc2c6a5c022259f6eu, 0xeab4d5ac9d4f1802u, 0x59a02195e670e695u,
+      0x370b53d695ff2107u, 0xea85862dc1d3a217u, 0x4a569e4417810babu
+    },
+    {  // cell 13
+      0x1131fd2980e0aba2u, 0x80bfa76bbe4c2534u, 0xa80baa392a8d332cu,
+      0xce28b85897a55d6eu, 0xc46dfcc1f3bfaa53u, 0xf99a9416ead5b559u,
+      0x2433106c81d5828eu, 0x21d143311fa71848u, 0xf102e8a4196acb7cu
+    },
+    {  // cell 14
+      0x40cdc2943fbddacdu, 0x5ccabf6b38311bd4u, 0x8e9faef454855ab8u,
+      0x49d072683fe83e1fu, 0x4d401776f7d68ed5u, 0x4219d865657e3b0eu,
+      0x8f7db819e0bf1685u, 0xfd3089981bd59020u, 0x6128d767e1f7bf66u
+    },
+    {  // cell 15
+      0x2acaca3d8a80a3d5u, 0x0ec0d14047b63081u, 0xcb0455b1d122060du,
+      0x2d6988b25e4e339bu, 0xbe04c4df3ce7ef73u, 0x2ad32b61beb6b351u,
+      0xad546acb571b8976u, 0x6a248d78715a44eau, 0x18b2888f6c52756cu
+    },
+    {  // cell 16
+      0x301f891a4aa45801u, 0xcc672e9f72c77bf0u, 0x4f9657827d7bbe4bu,
+      0x861b32d09cac6234u, 0x107a7e4f50b068cbu, 0x975d9d0055cca9fdu,
+      0xc30fb6270060a4feu, 0x04f27220088d452cu, 0xc43e9a6f1f5a6ea3u
+    },
+    {  // cell 17
+      0xc6d7273624d5b79cu, 0x06c09eb44c4cecc8u, 0x1d6a543e172095feu,
+      0xc25e568de06c8ad0u, 0x8c35facae2c95427u, 0xee9a55c87aaade2du,
+      0xe06f73ca32510c4au, 0xf44aad444b8232e4u, 0x3ff52ab3571f5c69u
+    },
+    {  // cell 18
+      0x7338d1524feb8c95u, 0x9f963aec710a69b8u, 0x335e34c984d9fa0bu,
+      0x75e1e21c36f1a518u, 0xa188f182ccd63930u, 0xcc37b9fe2cfe7038u,
+      0xf3e20432f520ecebu, 0xcf08772efbb5bc69u, 0x1c5b4c3ac632d972u
+    },
+    {  // cell 19
+      0xbf76a506227ed738u, 0xecaec6a79512a9eau, 0x813513d7f7c2b898u,
+      0xd0ae98007fc22becu, 0x8e579d992469e147u, 0xaf2dd2ff34444d85u,
+      0xd154a554c1ff178cu, 0x611690dcffefa366u, 0x4885115d41e50b12u
+    },
+    {  // cell 20
+      0x7313a098eea46036u, 0x0e4876e19a38221cu, 0xf2863bea53d27c1eu,
+      0x94b148dfec400822u, 0xe5a40870de5e66c1u, 0x923f869b656e14f1u,
+      0x54d84135337c706cu, 0xf6907ba36bd04dc9u, 0x8e769fb5d6f2c5eau
+    },
+    {  // cell 21
+      0xc61571ce4544960fu, 0xe99b1d308929669eu, 0x73496b4cdb1d6eedu,
+      0xfe5f58d63165949cu, 0x4dad40ca3552d9dcu, 0xd03ab9f7367baf38u,
+      0xca4f2d1acc484471u, 0x8981af38c1b5010cu, 0x792f9655d6b467c0u
+    },
+    {  // cell 22
+      0xe178ef0763b6b6c4u, 0xacfe0d9e1a3cde2eu, 0x22f2aa07e34eaa14u,
+      0xabdeff2d31e732d8u, 0x04456824f16cd906u, 0x0829a2978ff65557u,
+      0x9e03a9dbf7d9447fu, 0xace8d47738ffabd6u, 0xc94fd6af9e1de00du
+    },
+    {  // cell 23
+      0xf23e1b957227bceau, 0xc97e8b1f63d890f9u, 0x3f1aa3dc91851e21u,
+      0xba279520683303d5u, 0xa7d7cf84218bdf54u, 0x4a19eaac812a4f28u,
+      0x4904bd071e998899u, 0x0a63573014fa6368u, 0xc30e31f14a9443f9u
+    },
+    {  // cell 24
+      0x0e7e479661a4068du, 0x3bb37df652c98979u, 0x84c0261c5455e01du,
+      0x37039ecf7b5d51b1u, 0x62d09b5d59033fb1u, 0xda3aedfb4469099au,
+      0xec49d6d9fad33d1cu, 0xf81575d200209110u, 0x7ffd8057041f7addu
+    },
+    {  // cell 25
+      0x884f189d80e426c8u, 0x840afc0934f55129u, 0x8c9b92c1981d6f30u,
+      0x9487e3d39eb8c467u, 0x6e7da1446b28a7e7u, 0x5ae71d87e7d69503u,
+      0x393b337eab35b87cu, 0xe4551e8b61e01240u, 0x18893c0347567462u
+    },
+    {  // cell 26
+      0x3a3872a9f41124ecu, 0xd713d0b8670af95fu, 0x248ee0a369ad846fu,
+      0xe95adf127ae93cb8u, 0xdbc30261f295f0c3u, 0x10103d5e77b8e129u,
+      0xdb0cd63615f4f00bu, 0x533ff746314aa5ebu, 0xedc6fbf2b230f35fu
+    },
+    {  // cell 27
+      0x04202ea84346a0beu, 0xb3de5f7180a2fdb1u, 0xaea281c13123bb85u,
+      0xca10b8c9e84eaeccu, 0x141b168c985cba9cu, 0x168a4da57cfa3d14u,
+      0x2e3fc37937f50c2cu, 0x8012a654f50f77acu, 0xdb8ba0ef619ae15bu
+    },
+    {  // cell 28
+      0x6aede77d5b9da15bu, 0x6af898923ecc6fafu, 0xc9b6faf88ad98014u,
+      0x6fa2c3162984e142u, 0x21c682f136c0727bu, 0x4412daaec43d950bu,
+      0x0b7c16b732671eafu, 0xffb9ed2ebd2dcebeu, 0x14e2f30052cda40cu
+    },
+    {  // cell 29
+      0x66c8d0f233feb5c7u, 0x90dfba61f2ab8888u, 0xcb28bbe12b7b14d7u,
+      0xec1709b23425673fu, 0xe2489d42c399056du, 0x9cd6451e357eb090u,
+      0xd990a8d85832d692u, 0x114869258b8f4a53u, 0x5bd01ea5e87be143u
+    },
+    {  // cell 30
+      0x16f3c5d052893b52u, 0x41f9fb4a515b1055u, 0x20369d26c03f3e87u,
+      0xbadc75294460e09cu, 0xd591c2121c293239u, 0xef7f24e26c688a5du,
+      0xbaccb4e41602cb89u, 0x410d3413cd3f9905u, 0xadfdbe155ae9d838u
+    },
+    {  // cell 31
+      0x63fe65818ab2e35du, 0x93922cf939825d20u, 0x56a6747037883e90u,
+      0x57ac652c9cbb4fbeu, 0xfadaede76529181cu, 0x92f5410463073ebdu,
+      0x5dde61789d240089u, 0xa99a73cd7467149au, 0xd8b2511c319f1726u
+    },
+    {  // cell 32
+      0x0f3794af079bcf0fu, 0xbf4262d50048359cu, 0x59a4fd70c4466450u,
+      0x075d85579bcdab17u, 0xc7897e50cd5452a2u, 0x437c4e4f634112f0u,
+      0xe9c871946272cde1u, 0xef7229e489568d01u, 0x83fa9e0f10e26b64u
+    },
+    {  // cell 33
+      0x7e12a7a29fd797ccu, 0x2caade6f663012a5u, 0xe1500eb9396d3f17u,
+      0x9306a2647899b75au, 0x7a7825715715a49du, 0xbd3258c88475a415u,
+      0x9d68f83bfe0bb96cu, 0x2b03e52ee3a30d93u, 0x0a614eee5f8fe36du
+    },
+    {  // cell 34
+      0x7bb12e6346143de7u, 0x5ab26bc100f96f11u, 0x6143401368645c3eu,
+      0xb2ac785a39ac080cu, 0xe359bc4a38a2934fu, 0x08468a4b86bca978u,
+      0x804175397d0b44c8u, 0x02f9439aaccfbed8u, 0xb7015e30c44324dfu
+    },
+    {  // cell 35
+      0x36d47d1183f7eae1u, 0xa7f1b15b60d98193u, 0xa1669c938ca748e5u,
+      0xd6f4f6852b4b9705u, 0xaa94c5cf014fd7fbu, 0xcf05bf30aba369a1u,
+      0xe0049121a17b264bu, 0x1a8941c7fe263c74u, 0x373875ff890edf39u
+    },
+    {  // cell 36
+      0x91c01ef3fdcff2ddu, 0x060831f5cf4fac99u, 0x23c1ee77e14b08a4u,
+      0x135c9bd7a69a911eu, 0x58a9af3ba15c357cu, 0xc7862dca42b1acb4u,
+      0x14ad51d4c5000d0bu, 0xc9df7a800512b80du, 0x13f7b5246a4baca6u
+    },
+    {  // cell 37
+      0x42bace57ea7f6a35u, 0x8d852e6388dd8121u, 0x90e9c9d363ccea82u,
+      0x2ec478884b91ae69u, 0x0abbd61b3f448ad7u, 0x99ae83d8b0ea7100u,
+      0x09ea4d70698ee745u, 0xd4df7180af549611u, 0xa2bd4272fb74ca44u
+    },
+    {  // cell 38
+      0x61d85f34e7b563f5u, 0x37187d3d4c49c07cu, 0xcdf64f245090de46u,
+      0x374ee1e1fac6dec4u, 0xbc2f889e7b91905cu, 0x6448cce420c239a4u,
+      0xb1c3aeafab287994u, 0xeb71880088b30eb1u, 0x9736d674a5ca87cfu
+    },
+    {  // cell 39
+      0xe0bfb13db3ae2af5u, 0xaf67e5df4486896bu, 0x0b506465a7da6fe7u,
+      0x40fa079d9a4b5a25u, 0x62f06576986d1b9au, 0x94b3dfe0b97aa1ccu,
+      0xc97a28dbd87cde7au, 0xaa689360ebba0be5u, 0x5e6c3a1a929b52d9u
+    },
+    {  // cell 40
+      0xb4167d72c25e5c4eu, 0x0d09756dc3727834u, 0x6c5e8be39e399b91u,
+      0x7884c67731243eadu, 0x28c53195eff98e40u, 0x7b8e4a5c3c3c7a67u,
+      0xd557fd1d421ba73du, 0x2e5427a11336db89u, 0x5e5e150f6474d9e1u
+    },
+    {  // cell 41
+      0xd6047b2f7746d784u, 0xba05287276fda6d8u, 0xf52fadbb9adca4cau,
+      0x27a51ba9604f6951u, 0x9b15113fae829291u, 0xc1458504f17d951du,
+      0x821f62e3b78639e2u, 0x0509580b3f91027fu, 0x94ef96113df460aeu
+    },
+    {  // cell 42
+      0xa6b545169ac7d810u, 0x8361ccbc77770d47u, 0x53cb08e1aaa7dcafu,
+      0x4e852dbb0edba9c9u, 0x608cc1b16695e338u, 0x0a41ad1a60bbb67du,
+      0xddc014d40632ad6cu, 0xa789ca9a48ba4703u, 0x916cd622efd64fe0u
+    },
+    {  // cell 43
+      0x66803dec88e54b8cu, 0x33aff5725992637au, 0x13bb53f935883aa0u,
+      0x144bf3c11504c8b0u, 0x848190f5956e086au, 0xf6c733f3333331e9u,
+      0x50b7652a78050c0eu, 0x79be5837ba25d788u, 0xd3adf057280cd32du
+    },
+    {  // cell 44
+      0x8642e9e4ce5e684bu, 0x9eb06646eaa26a2fu, 0xa0d3dfb4a6eb5caeu,
+      0x37e487d62f153420u, 0x3db2c2a965382636u, 0x7d725dbee69fe8acu,
+      0x9dfa1edc0dd4af1au, 0x08f58390dce28cb1u, 0xbd55b6c7c6925adcu
+    },
+    {  // cell 45
+      0x7ae2b63e98a96bceu, 0x735cc55320348fe9u, 0x0572b06efcc8fdaeu,
+      0x2088539eabe6ddb2u, 0x944a05791c7e99f1u, 0xd3eed70375ff172cu,
+      0x06d2489922976217u, 0x011758a281cfb10bu, 0x8070b2678a1970e0u
+    },
+    {  // cell 46
+      0x77101befc5c6bf4eu, 0xa65589cc771cce44u, 0xfe7e353de4f78543u,
+      0xefbc4826d2d20e91u, 0x7b341cc319657d29u, 0xbbe1ca210a1bad39u,
+      0x8be3151a911fbef1u, 0xdd96d758e233f201u, 0x054e871c9810e751u
+    },
+    {  // cell 47
+      0x829f17aa3fef0821u, 0xd8d47b801db3c679u, 0x86eadc7b06b61017u,
+      0x825a5891364b0a72u, 0xe1d50c38b565bf57u, 0xab306268bf0c25d1u,
+      0xe82bcbbeddc329aau, 0x9ccae45239911f60u, 0x750c3d66b64de07au
+    },
+    {  // cell 48
+      0x0bf0ccf6722c80a8u, 0xe01ad5d051b447beu, 0x3ef92d1f9337d65au,
+      0x25dba794445c45e7u, 0x6fdb5554e6ebf947u, 0xefb466a760886eedu,
+      0x35a1286e7dbc9a53u, 0xa626d1e24e69502au, 0x634e3b72b2ada09bu
+    },
+    {  // cell 49
+      0x9d2a904ad6e08eeeu, 0xb90a73a548d54868u, 0x270d2f0e33c2bd43u,
+      0xb11b1dd1f6b16de3u, 0x2d23c2f137d3ecc6u, 0x1537c9d6d9487b45u,
+      0x7c643560e9d6b3c7u, 0x3591cb43ab283abcu, 0x5470781a66bf95aau
+    },
+    {  // cell 50
+      0x5a319778bff6ef0cu, 0x8778b1895c78d77eu, 0xa16a2145a38da01du,
+      0xc79883c47c0e7b7bu, 0xd05341aedafe86c3u, 0x0039e1f34757bcd9u,
+      0x13ff3deba107c1c7u, 0x8764cb95350e4e61u, 0x4c5b25004188396cu
+    },
+    {  // cell 51
+      0xad3223c78648c4adu, 0x32f060030c8b1c90u, 0x000afcb5e1c72f4eu,
+      0xb5e8b421706c86e2u, 0xdbd7ec7b59716d30u, 0x9a6f8bca48f4cfb7u,
+      0x140f5f013a1345b8u, 0xc0ccd4a2f0f4caeeu, 0xc2912382d8de315du
+    },
+    {  // cell 52
+      0xd1f50da4be0879fdu, 0x2b96d5baf1bda054u, 0xd88c9d78b7a22c57u,
+      0x6c3b7ef67ebd6932u, 0x7485b9de399d98e6u, 0x4360e8731b662fd4u,
+      0xa9a247c85ee9a0f7u, 0xf37090d46687bdceu, 0x5a1d396f4dab5634u
+    },
+    {  // cell 53
+      0xff974545c040e6a1u, 0x2b03d9b6b1efcf6du, 0x3910e315581ea1ceu,
+      0x1823b096bd836d13u, 0x6432b29502113ed2u, 0x0a0157680ca017ecu,
+      0x2e87094d37814f6eu, 0xf59d260d4733db78u, 0xc6ea6e7cb63e5a92u
+    },
+    {  // cell 54
+      0x2bc8efa4faff48bdu, 0x30e7cc350bac18fcu, 0x323dfeaf1b152bcau,
+      0xa2cf95994fff0234u, 0xb1937ed2a12cf2bcu, 0xc3ae251798d19565u,
+      0xbfd9e588a37b56a3u, 0xc7dfe9bf2c8d1436u, 0xbb9b10812093b782u
+    },
+    {  // cell 55
+      0xaecd36e9c707865eu, 0xeb5cd82ed6ebaa76u, 0x04e3e42d05e49f15u,
+      0x206d874018ffead4u, 0xf18297daa2b47861u, 0x7423b99396de96afu,
+      0x986c6c8c20691a00u, 0x29539673a4f256a0u, 0xe436482e34cf64afu
+    },
+    {  // cell 56
+      0x962127f4fd91243eu, 0xfd7a40c10ebe8088u, 0x7a78a42b6ec2955fu,
+      0x68fe90ef25204a89u, 0x88499d4ee6e4ded9u, 0xbd754298ea58a32du,
+      0x54f15eaab27d760cu, 0x72f3355b8025f078u, 0xc6fdd73cd832942eu
+    },
+    {  // cell 57
+      0x09d327dcd52fb6c5u, 0x7de67351bd7a8acdu, 0xd375f7ed6ed8fd6eu,
+      0x7a96bfbb00ad7c48u, 0x43d92fcec47a4b61u, 0xfab568c3cf6cd6fcu,
+      0x0e431afb4b61f5cdu, 0xc34a80d61e6e3a3bu, 0x4fcc2dac0ed376dbu
+    },
+    {  // cell 58
+      0x9b3a3d4c69228047u, 0xba4b5894ca59dc78u, 0xcac74b8dc512fc1fu,
+      0xbba8c5ce57864ac1u, 0x4c3b7d99593a0c95u, 0xa4ad83f402ccb69fu,
+      0x65897e00cf82300fu, 0x0b75988c26e70559u, 0x5f9265495467f1acu
+    },
+    {  // cell 59
+      0xf8ddd6d214a661e4u, 0x7532d1c814f31d04u, 0x57705c7a1c0b3df6u,
+      0x746f1c186eb536acu, 0xa5aaa62e6e47a081u, 0xefe3a430d869f66cu,
+      0x3bd67d51870eeb0eu, 0xcd9d9ed6231dadcbu, 0x3ffc2ab5541fce06u
+    },
+    {  // cell 60
+      0x11b287c761b0618eu, 0xbfb8ef0899e7f3a4u, 0x57d27f6a2fcd8fd3u,
+      0x4b0b9645b5f8ad62u, 0xa31400a27faf4670u, 0xad6ec5f62794f82fu,
+      0xd2da5cbcd8966816u, 0xd9e78130173e9137u, 0x9ccb2c13713d6a1cu
+    },
+    {  // cell 61
+      0x697dbaaa5526d98bu, 0x2ecb4c632423a1bfu, 0xf5eaa4daf2335327u,
+      0x915d159e87743bc5u, 0x8a65b06d3755a9d8u, 0x1c69686fffe21273u,
+      0xde4ab6362e9857ddu, 0xdde59a9b9cfcc480u, 0x1b662e255216a94eu
+    },
+    {  // cell 62
+      0x7525f0006f91d420u, 0x087346aeedf9cd3au, 0x3e79284b8732c395u,
+      0x05c402eb7f66e251u, 0x6d4f7443df1cbc37u, 0x1acf7d21b60ccbb5u,
+      0x6da5f8d9f4f516b0u, 0x74c382adefb4f030u, 0x8adc4e8413501b49u
+    },
+    {  // cell 63
+      0xfde3480f3aa00fdfu, 0x4d521fe0054a5a87u, 0x3202e671a11362a6u,
+      0x534c1866ae5dc69au, 0x70bd399b98258f88u, 0x44d52f24f40c7ac5u,
+      0x1a2ddfb455d5e881u, 0xb94687342fc3520au, 0xd756573655974f57u
+    },
+    {  // cell 64
+      0x988e4bb18e6e5a46u, 0xee1c8bbdabf7de77u, 0x49ee1a56ec1f9c3du,
+      0x744d539ea2f4bd56u, 0x9d550e86a6a14a84u, 0xbba7b0c9f11dd659u,
+      0xcf4da595c2329618u, 0x759043e036fb9039u, 0x0da55437251edec9u
+    },
+    {  // cell 65
+      0xcf6ebeb9e2cf74b0u, 0x27d291d0d4600609u, 0xb2edc0c2b5744aabu,
+      0x5fa81ec29a4f08e3u, 0xa41e9e813946b325u, 0xf1c2c22973ead933u,
+      0xb2ad21b1d1575c26u, 0x3a68c0944e322eceu, 0x6220408504342cf8u
+    },
+    {  // cell 66
+      0xf54ef534a6b31fa4u, 0x17fb307ef9046e70u, 0xc808bca31303d096u,
+      0x92a1a891abe67f7bu, 0x9404a9b06ac21e95u, 0xed70df694f7c40f0u,
+      0x2c27d780562ef15cu, 0xc87114cb9939bf86u, 0x8041308f17e334e0u
+    },
+    {  // cell 67
+      0x750bb326aa1c1395u, 0xafc00487ebd40973u, 0x9c8b4ccb7f5587e4u,
+      0x4acab5cd3f7be9a8u, 0x7937bdb070312c94u, 0x59e38d123490a548u,
+      0xe2366738662a7376u, 0x06bd845d320a6c3au, 0xfa4cdf4a0d3bcca3u
+    },
+    {  // cell 68
+      0x466e51017f1268afu, 0x67d80dfe52430dd1u, 0x21a0456da84e48a7u,
+      0x17793af5d0101891u, 0x6ec174ffd95fadbbu, 0x23502ac4b573a1a4u,
+      0x6a131221909a14f0u, 0xf83a55e98f832f53u, 0x1db5f6d0c2b33b56u
+    },
+    {  // cell 69
+      0x46491c505b0715afu, 0xcd3adc2d1490eb75u, 0xf678aeadb3ac78f9u,
+      0xc57cafe7076caf44u, 0xa99642cb9bb470a3u, 0x071e268b78e86d3bu,
+      0x433a81b506091168u, 0x18a14032d74440d4u, 0xdda846a11a025051u
+    },
+    {  // cell 70
+      0x5cc06e8887e8c88eu, 0xd72c9e29e7f65837u, 0x6304246cc1f490efu,
+      0x906004c51f0df910u, 0x0ca4eaf4cf791b87u, 0x523b7243127af30cu,
+      0xbd5f199111e397adu, 0x5a9468059ee259b6u, 0xba80d57247744ef3u
+    },
+    {  // cell 71
+      0x4176d1f709d80ffbu, 0xd579f436663abc6bu, 0x14a3ed12420d13b1u,
+      0xb5d510bd8a1637c4u, 0x8c32366b24a3e6a7u, 0x0fe3e31d1ebc7e8fu,
+      0x634774c4f33d4f5cu, 0xc410a3b107d42852u, 0x379f0dd14dfcba97u
+    },
+    {  // cell 72
+      0x8a27c43bf700815eu, 0x482ef55d3bc53a7bu, 0x5cc51ee9bd77ab20u,
+      0xb72741842371487fu, 0x3c2738baad342fecu, 0xe94abcd3d262158cu,
+      0xd707fba7d9aee388u, 0x04cc96cf55836096u, 0x34af44d4339ecc7du
+    },
+    {  // cell 73
+      0xcbad82a2bd143d2eu, 0x9d45ed81cf528b66u, 0xdb89b20a4ecebfb1u,
+      0x73fa9bff2cd4378bu, 0xc33d5ebb4716fc40u, 0xd91df0d04a2e8cb8u,
+      0x604b104cddac1decu, 0x220e6da26e43c952u, 0x9e68f9ca0f784e68u
+    },
+    {  // cell 74
+      0x93a829511f2a8507u, 0x683024c9bd62aa99u, 0x84808dc7d23dbfa0u,
+      0xd1b16fc00c4c39c4u, 0x4564228994eecf47u, 0x79c7ec81eddf3d12u,
+      0x5d1890d499068cddu, 0x142b18fc4f3bc946u, 0x3dd337c923618f99u
+    },
+    {  // cell 75
+      0x7591ab7a7e94791bu, 0x0b93fb5e80f0a6a4u, 0xaf2820d1ea604bacu,
+      0xccca0ac2b21bb8dcu, 0xc1522a3ddb3bea1du, 0x543c55856197cdcfu,
+      0xab1a7c2e59834d3eu, 0xd1f00c38bca52bb5u, 0xb207741f06468cb8u
+    },
+    {  // cell 76
+      0xbbbc90698fa277d1u, 0xb90cae9eaa6ebe7au, 0x1bec473578fd8a4cu,
+      0xeafdd9b3a65b9202u, 0xa1bdbd73cf5d048eu, 0x0b10c73d83082995u,
+      0x8fbf1c9f4368ab90u, 0x68f6d14a9e895ec5u, 0xfccbc51340a6e149u
+    },
+    {  // cell 77
+      0x2030b13d55cf87b4u, 0xf7b00a12086adc43u, 0x550fb7f0b0bc8a63u,
+      0x362477092ea7056eu, 0x704a2c8754d46dd4u, 0x1a044f6d2ee87a62u,
+      0x77ff735d89409a73u, 0x554267a82fb6c0b7u, 0x0e6c2accf76d732bu
+    },
+    {  // cell 78
+      0x358c3d36a48a4ea7u, 0xf102d0f952f470a5u, 0x7cae23c67b0baadau,
+      0x76d32dfc460962c2u, 0xcf3272204cb5ec8eu, 0xca69966dfbaad9a1u,
+      0xcc77f394206ad431u, 0xfb691807e3dc6ad7u, 0xa66786fc62d21256u
+    },
+    {  // cell 79
+      0xcabc89d587bc7ec6u, 0xba3a8759de4a6ff6u, 0xfa3dd128c09f876du,
+      0x5f2044b96bc2cff1u, 0x6abbe452d04cef1eu, 0x3f1e45472fda9290u,
+      0xfdb913063aedc3c8u, 0x89908df803672867u, 0x52da21e4f5030863u
+    },
+    {  // cell 80
+      0xfa756289ff83dd5au, 0xefb6cd9944aaa30eu, 0xad80e37c19eff56au,
+      0x54743699cad56b87u, 0x8072441b62e82c8eu, 0x3c67c516c19474d5u,
+      0x488dbbc2bb157cddu, 0x3150acfa8da6b36bu, 0x7768791d73172dc6u
+    }
+};
@@ -0,0 +1,37 @@
+/*
+  sudoku zobrist.h
+
+  Suduku game: zobrist hash of grid candidates
+*/
+
+#ifndef __ZOBRIST_H__
+#define __ZOBRIST_H__
+
+#include <stdint.h>
+#include "sudoku.h"
+#include "bitops.h"
+
+/* The hash of a grid is the exclusive or of a constant random key for each
+   (cell, candidate) pair in the grid, so that adding or removing a candidate
+   in a cell just toggles that key in the hash, whatever the other cells. Two
+   grids with the same candidates in the same cells have the same hash, the
+   empty grid having a 0 hash. Given cells and the selection do not change
+   the hash.
+
+   A cell is given by its index, row * SUDOKU_N_COLS + col, as in units.h. */
+typedef uint64_t grid_hash_t;
+
+extern const grid_hash_t zobrist_keys[SUDOKU_N_CELLS][SUDOKU_N_SYMBOLS];
+
+// return the hash of the candidates in map for the cell. Toggling candidates
+// in a cell toggles the hash of the map of toggled candidates in the grid hash.
+static inline grid_hash_t get_map_hash( int cell, int map )
+{
+    grid_hash_t hash = 0;
+    while ( map ) {
+        hash ^= zobrist_keys[ cell ][ extract_bit_from_map( &map ) ];
+    }
+    return hash;
+}
+
+#endif /* __ZOBRIST_H__ */